@@ -0,0 +1,168 @@
+#include "arc_length_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#include "constants.hpp"
+#include "utilities.hpp"
+
+namespace reprojection_calibration::spline {
+
+// Five point Gauss-Legendre rule mapped from [-1, 1] onto [0, 1] - the speed is the square root of a quartic in u, so
+// it is not integrated exactly, but it is smooth enough within one segment for this to be accurate to many digits.
+constexpr std::array<double, 5> gauss_legendre_nodes{0.04691007703066800, 0.23076534494715845, 0.5,
+                                                     0.76923465505284155, 0.95308992296933200};
+constexpr std::array<double, 5> gauss_legendre_weights{0.11846344252809454, 0.23931433524968324, 0.28444444444444444,
+                                                       0.23931433524968324, 0.11846344252809454};
+
+ArcLengthIndex::ArcLengthIndex(r3Spline const& spline)
+    : spline_{spline}, cumulative_lengths_{0.0}, synced_version_{0} {
+    Update();
+}
+
+int ArcLengthIndex::Update() {
+    size_t const num_knots{std::size(spline_.knots_)};
+    size_t const num_segments{(num_knots < constants::k) ? 0 : num_knots - constants::k + 1};
+    size_t const num_integrated{std::min(std::size(segment_lengths_), num_segments)};
+
+    DirtySegmentTracker const& tracker{spline_.Tracker()};
+    std::vector<int> const dirty_segments{tracker.DirtySegments(num_knots, synced_version_)};
+    synced_version_ = tracker.Version();
+
+    segment_coefficients_.resize(num_segments);
+    segment_lengths_.resize(num_segments);
+    int num_updated{0};
+    for (int const s : dirty_segments) {
+        if (static_cast<size_t>(s) < num_integrated) {
+            IndexSegment(s);
+            ++num_updated;
+        }
+    }
+    for (size_t s{num_integrated}; s < num_segments; ++s) {
+        IndexSegment(static_cast<int>(s));
+        ++num_updated;
+    }
+
+    // The sum is trivial compared to the quadrature, so it is simply redone from the front
+    cumulative_lengths_.resize(num_segments + 1);
+    std::partial_sum(std::cbegin(segment_lengths_), std::cend(segment_lengths_), std::begin(cumulative_lengths_) + 1);
+
+    return num_updated;
+}
+
+double ArcLengthIndex::Length() const { return cumulative_lengths_.back(); }
+
+std::optional<double> ArcLengthIndex::Distance(uint64_t const t_ns) const {
+    if (NumSegments() == 0) {
+        return std::nullopt;
+    }
+
+    // Only the indexed segments are valid, even if knots were appended to the spline since the last Update()
+    size_t const num_indexed_knots{static_cast<size_t>(NumSegments() + constants::k - 1)};
+    auto const normalized_position{spline_.Timing().SplinePosition(t_ns, num_indexed_knots)};
+    if (not normalized_position.has_value()) {
+        return std::nullopt;
+    }
+    auto const [u_i, i]{normalized_position.value()};
+
+    return cumulative_lengths_[i] + PartialLength(i, u_i);
+}
+
+std::optional<double> ArcLengthIndex::Time(double const distance) const {
+    if (NumSegments() == 0 or distance < 0 or distance > Length()) {
+        return std::nullopt;
+    }
+
+    // The cumulative lengths are monotone, so the segment is found by binary search
+    auto const upper{std::upper_bound(std::cbegin(cumulative_lengths_), std::cend(cumulative_lengths_), distance)};
+    int const segment{std::min(static_cast<int>(upper - std::cbegin(cumulative_lengths_)) - 1, NumSegments() - 1)};
+
+    double const u{SegmentU(segment, distance - cumulative_lengths_[segment])};
+
+    return (segment + u) * spline_.Timing().delta_t_ns_;
+}
+
+std::vector<std::tuple<double, VectorD>> ArcLengthIndex::Resample(double const spacing) const {
+    assert(spacing > 0);
+
+    std::vector<std::tuple<double, VectorD>> samples;
+    if (NumSegments() == 0) {
+        return samples;
+    }
+
+    double const delta_t_ns{static_cast<double>(spline_.Timing().delta_t_ns_)};
+
+    int segment{0};
+    for (int n{0}; n * spacing <= Length(); ++n) {
+        double const distance{n * spacing};
+        while (segment < NumSegments() - 1 and cumulative_lengths_[segment + 1] < distance) {
+            ++segment;
+        }
+
+        double const u{SegmentU(segment, distance - cumulative_lengths_[segment])};
+        samples.push_back({(segment + u) * delta_t_ns, segment_coefficients_[segment] * r3Spline::CalculateU(u)});
+    }
+
+    return samples;
+}  // LCOV_EXCL_LINE
+
+int ArcLengthIndex::NumSegments() const { return static_cast<int>(std::size(cumulative_lengths_)) - 1; }
+
+void ArcLengthIndex::IndexSegment(int const segment) {
+    static MatrixKK const M{BlendingMatrix(constants::k)};  // Static means it only evaluates once :)
+
+    segment_coefficients_[segment] =
+        Eigen::Map<const MatrixDK>(spline_.knots_[segment].data(), constants::d, constants::k) * M;
+    segment_lengths_[segment] = PartialLength(segment, 1.0);
+}
+
+double ArcLengthIndex::Speed(int const segment, double const u) const {
+    return (segment_coefficients_[segment] * r3Spline::CalculateU(u, DerivativeOrder::First)).norm();
+}
+
+double ArcLengthIndex::PartialLength(int const segment, double const u) const {
+    double length{0};
+    for (size_t j{0}; j < std::size(gauss_legendre_nodes); ++j) {
+        length += gauss_legendre_weights[j] * Speed(segment, u * gauss_legendre_nodes[j]);
+    }
+
+    return u * length;
+}
+
+double ArcLengthIndex::SegmentU(int const segment, double const distance) const {
+    double const segment_length{cumulative_lengths_[segment + 1] - cumulative_lengths_[segment]};
+    if (segment_length <= 0) {
+        return 0;  // The spline does not move in this segment, any u is as good as any other
+    }
+
+    // Newton's method on PartialLength(u) - distance = 0, whose derivative is the speed, starting from the constant
+    // speed guess. The root stays bracketed by [lower, upper], and wherever the Newton step would leave the bracket
+    // (ex. near a point where the spline comes to a stop and the speed goes to zero) we bisect instead, so that the
+    // iteration always converges. CalculateU() only accepts u in [0, 1), hence the clamping.
+    double lower{0.0};
+    double upper{std::nextafter(1.0, 0.0)};
+    double u{std::clamp(distance / segment_length, lower, upper)};
+    for (int iteration{0}; iteration < 64; ++iteration) {
+        double const error{PartialLength(segment, u) - distance};
+        if (error > 0) {
+            upper = u;
+        } else {
+            lower = u;
+        }
+
+        double const speed{Speed(segment, u)};
+        double const u_newton{(speed > 0) ? u - error / speed : lower - 1};
+        double const u_next{(lower <= u_newton and u_newton <= upper) ? u_newton : (lower + upper) / 2};
+        bool const converged{std::abs(u_next - u) < 1e-12};
+        u = u_next;
+        if (converged) {
+            break;
+        }
+    }
+
+    return u;
+}
+
+}  // namespace reprojection_calibration::spline
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "r3_spline.hpp"
+#include "types.hpp"
+
+namespace reprojection_calibration::spline {
+
+// Precomputed arc length of an r3Spline, for consumers that need positions at equal distances along the trajectory
+// instead of at equal times. The index stores the cumulative length at the start of every segment, where the length
+// of a segment is the Gauss-Legendre quadrature of the speed |dp/du|. Time to distance is then O(1) plus one partial
+// segment quadrature, distance to time is a binary search over the segments plus a few Newton steps on u.
+//
+// Times are returned as the (fractional) nanoseconds elapsed since t0_ns, which is exactly what the offset overload
+// r3Spline::Evaluate(t0_ns, elapsed_ns) accepts.
+//
+// WARN(Jack): The index keeps a reference to the spline, so the spline has to outlive it.
+class ArcLengthIndex {
+   public:
+    explicit ArcLengthIndex(r3Spline const& spline);
+
+    // Brings the index up to date with the spline - only the segments added since the last call and the segments that
+    // the spline's dirty segment tracker marked since the last call are integrated again, then the cumulative lengths
+    // are summed up again. The index follows the tracker by version, so clearing the tracker does not affect it. Knot
+    // edits that bypass the tracker (i.e. writing to knots_ directly) are not detected, appending to knots_ directly
+    // is. Returns the number of segments that were integrated.
+    //
+    // All queries answer for the spline as it was at the last Update() - the index keeps its own copy of the segment
+    // coefficients, so editing or erasing knots in between is safe, it is just not visible yet.
+    int Update();
+
+    double Length() const;
+
+    // Arc length from the start of the spline up to the time t_ns.
+    std::optional<double> Distance(uint64_t const t_ns) const;
+
+    // Inverse of Distance() - the nanoseconds elapsed since t0_ns at which the arc length reaches distance.
+    std::optional<double> Time(double const distance) const;
+
+    // Samples the spline every spacing meters along the trajectory, starting at the very beginning, as (elapsed
+    // nanoseconds since t0_ns, position) pairs. Walks the segments once front to back so there is no per sample search.
+    std::vector<std::tuple<double, VectorD>> Resample(double const spacing) const;
+
+   private:
+    int NumSegments() const;
+
+    void IndexSegment(int const segment);  // Copies the coefficients of the segment from the spline and integrates it
+
+    double Speed(int const segment, double const u) const;  // |dp/du|, not per nanosecond!
+
+    double PartialLength(int const segment, double const u) const;  // Arc length from the start of the segment to u
+
+    double SegmentU(int const segment, double const distance) const;  // Inverse of PartialLength()
+
+    r3Spline const& spline_;
+    std::vector<MatrixDK> segment_coefficients_;  // Control points times the blending matrix P * M of each segment
+    std::vector<double> segment_lengths_;
+    std::vector<double> cumulative_lengths_;  // Arc length at the start of each segment plus the total at the end
+    uint64_t synced_version_;                 // Tracker version at the last Update()
+};
+
+}  // namespace reprojection_calibration::spline
@@ -0,0 +1,141 @@
+#include "arc_length_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "constants.hpp"
+
+using namespace reprojection_calibration::spline;
+
+TEST(ArcLengthIndex, TestArcLengthIndexStraightLine) {
+    // Knots evenly spaced on a line give a constant speed of one knot spacing per segment
+    r3Spline r3_spline{100, 10};
+    ArcLengthIndex const empty_index{r3_spline};
+    EXPECT_EQ(empty_index.Length(), 0);
+    EXPECT_EQ(empty_index.Distance(100), std::nullopt);
+    EXPECT_EQ(empty_index.Time(0), std::nullopt);
+    EXPECT_TRUE(empty_index.Resample(1.0).empty());
+
+    for (int i{0}; i < 7; ++i) {
+        r3_spline.knots_.push_back(VectorD{2.0 * i, 0, 0});
+    }
+    ArcLengthIndex const index{r3_spline};
+
+    EXPECT_NEAR(index.Length(), 4 * 2.0, 1e-12);  // Four segments of length two
+    EXPECT_NEAR(index.Distance(100).value(), 0, 1e-12);
+    EXPECT_NEAR(index.Distance(125).value(), 5, 1e-12);
+    EXPECT_EQ(index.Distance(140), std::nullopt);
+
+    EXPECT_NEAR(index.Time(5).value(), 25, 1e-9);
+    EXPECT_EQ(index.Time(-1), std::nullopt);
+    EXPECT_EQ(index.Time(9), std::nullopt);
+}
+
+TEST(ArcLengthIndex, TestArcLengthIndexStationary) {
+    // The spline stands still for the whole first segment and starts moving from zero speed in the second one as
+    // p(u) = u^3 / 6, so the Newton iteration on the second segment has to fall back to bisection near the standstill
+    uint64_t const delta_t_ns{10};
+    r3Spline r3_spline{0, delta_t_ns};
+    for (int i{0}; i < 4; ++i) {
+        r3_spline.knots_.push_back(VectorD::Zero());
+    }
+    r3_spline.knots_.push_back(VectorD{1, 0, 0});
+    ArcLengthIndex const index{r3_spline};
+    EXPECT_NEAR(index.Length(), 1.0 / 6, 1e-12);
+
+    // Any time in the stationary segment is as good as any other, resampling starts at the beginning of it
+    auto const samples{index.Resample(1.0)};
+    ASSERT_EQ(std::size(samples), 1);
+    EXPECT_EQ(std::get<0>(samples[0]), 0);
+    EXPECT_TRUE(std::get<1>(samples[0]).isZero());
+
+    // Distance u^3 / 6 with u = 0.1, where the constant speed guess u = 0.001 is far too small
+    double const distance{std::pow(0.1, 3) / 6};
+    EXPECT_NEAR(index.Time(distance).value(), 1.1 * delta_t_ns, 1e-9);
+    EXPECT_NEAR(index.Time(0).value(), delta_t_ns, 1e-9);
+}
+
+TEST(ArcLengthIndex, TestArcLengthIndexCurve) {
+    uint64_t const delta_t_ns{100};
+    r3Spline r3_spline{0, delta_t_ns};
+    for (int i{0}; i < 10; ++i) {
+        r3_spline.knots_.push_back(VectorD{std::cos(0.7 * i), std::sin(0.7 * i), 0.1 * i * i});
+    }
+    ArcLengthIndex const index{r3_spline};
+
+    // Compare against the dense sampling (midpoint rule on every nanosecond) this index replaces
+    double dense_length{0};
+    for (uint64_t t_ns{0}; t_ns < 7 * delta_t_ns; ++t_ns) {
+        dense_length += r3_spline.Evaluate(t_ns, 0.5, DerivativeOrder::First)->norm();
+    }
+    EXPECT_NEAR(index.Length(), dense_length, 1e-5 * dense_length);
+
+    // Distance and time are inverses of one another
+    for (uint64_t const t_ns : {0, 55, 100, 333, 699}) {
+        double const distance{index.Distance(t_ns).value()};
+        EXPECT_NEAR(index.Time(distance).value(), t_ns, 1e-6);
+    }
+
+    // Consecutive resampled positions are (up to the chord/arc difference) the spacing apart
+    double const spacing{0.05};
+    auto const samples{index.Resample(spacing)};
+    EXPECT_EQ(std::size(samples), static_cast<size_t>(std::floor(index.Length() / spacing)) + 1);
+    for (size_t i{1}; i < std::size(samples); ++i) {
+        auto const [t_0, p_0]{samples[i - 1]};
+        auto const [t_1, p_1]{samples[i]};
+        EXPECT_LT(t_0, t_1);
+        EXPECT_NEAR((p_1 - p_0).norm(), spacing, 1e-3 * spacing);
+        EXPECT_TRUE(p_1.isApprox(r3_spline.Evaluate(0, t_1).value()));
+    }
+}
+
+TEST(ArcLengthIndex, TestArcLengthIndexUpdate) {
+    r3Spline r3_spline{0, 10};
+    for (int i{0}; i < 6; ++i) {
+        r3_spline.knots_.push_back(VectorD{std::sin(i), 0.5 * i, std::cos(2.0 * i)});
+    }
+    ArcLengthIndex index{r3_spline};
+    EXPECT_EQ(index.Distance(30), std::nullopt);
+
+    // Appended knots are picked up by the next update, and only their segment is integrated
+    r3_spline.knots_.push_back(VectorD{1, 2, 3});
+    EXPECT_EQ(index.Update(), 1);
+    ASSERT_TRUE(index.Distance(30).has_value());
+    EXPECT_NEAR(index.Length(), ArcLengthIndex{r3_spline}.Length(), 1e-12);
+
+    // Edits made through the knot editing API invalidate the affected segments, knot 1 influences segments 0 and 1
+    r3_spline.SetKnot(1, VectorD{10, 10, 10});
+    EXPECT_EQ(index.Update(), 2);
+    ArcLengthIndex const fresh_index{r3_spline};
+    EXPECT_NEAR(index.Length(), fresh_index.Length(), 1e-12);
+    EXPECT_NEAR(index.Distance(25).value(), fresh_index.Distance(25).value(), 1e-12);
+
+    // Nothing changed since the last update, and the owner clearing the tracker does not hide an edit from the index
+    EXPECT_EQ(index.Update(), 0);
+    r3_spline.SetKnot(3, VectorD{-1, 0, 1});
+    r3_spline.ClearDirtySegments();
+    EXPECT_EQ(index.Update(), 4);
+    EXPECT_NEAR(index.Length(), ArcLengthIndex{r3_spline}.Length(), 1e-12);
+}
+
+TEST(ArcLengthIndex, TestArcLengthIndexEraseBeforeUpdate) {
+    r3Spline r3_spline{100, 10};
+    for (int i{0}; i < 7; ++i) {
+        r3_spline.knots_.push_back(VectorD{2.0 * i, 0, 0});
+    }
+    ArcLengthIndex index{r3_spline};
+
+    // Until the next update the index still answers for the erased last segment, without reading the erased knot
+    r3_spline.EraseKnot(6);
+    EXPECT_NEAR(index.Length(), 8, 1e-12);
+    EXPECT_NEAR(index.Distance(135).value(), 7, 1e-12);
+    EXPECT_NEAR(index.Time(7).value(), 35, 1e-9);
+    auto const samples{index.Resample(1.0)};
+    ASSERT_EQ(std::size(samples), 9);
+    EXPECT_TRUE(std::get<1>(samples.back()).isApprox(VectorD{10, 0, 0}));
+
+    index.Update();
+    EXPECT_NEAR(index.Length(), 6, 1e-12);
+    EXPECT_EQ(index.Distance(135), std::nullopt);
+}
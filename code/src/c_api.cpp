@@ -0,0 +1,148 @@
+#include "c_api.h"
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+#include "se3_spline.hpp"
+#include "types.hpp"
+
+using reprojection_calibration::spline::Se3Spline;
+using reprojection_calibration::spline::Vector6d;
+
+using PoseMatrix = Eigen::Matrix<double, 4, 4, Eigen::RowMajor>;
+
+struct SplineSe3 {
+    Se3Spline spline;
+};
+
+namespace {
+
+// Shared loop of the batch functions - evaluate(t_ns, output) writes one result and returns false if t_ns is invalid.
+// No exception can escape through here (the evaluation functions do not allocate) which is important as we are called
+// from C.
+template <typename Evaluator>
+int64_t EvaluateBatch(size_t const count, uint64_t const* const t_ns, ptrdiff_t const t_stride, double* const output,
+                      ptrdiff_t const output_stride, uint8_t* const valid_mask, Evaluator const& evaluate) {
+    if (count == 0) {
+        return 0;
+    }
+    if (t_ns == nullptr or output == nullptr or valid_mask == nullptr) {
+        return SPLINE_ERROR_NULL_POINTER;
+    }
+
+    std::fill(valid_mask, valid_mask + (count + 7) / 8, 0);
+
+    int64_t num_valid{0};
+    for (size_t i{0}; i < count; ++i) {
+        ptrdiff_t const n{static_cast<ptrdiff_t>(i)};
+        if (evaluate(t_ns[n * t_stride], output + n * output_stride)) {
+            valid_mask[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+            ++num_valid;
+        }
+    }
+
+    return num_valid;
+}
+
+}  // namespace
+
+extern "C" {
+
+SplineSe3* spline_se3_create(uint64_t const t0_ns, uint64_t const delta_t_ns) {
+    try {
+        return new SplineSe3{Se3Spline{t0_ns, delta_t_ns}};
+    } catch (std::bad_alloc const&) {  // LCOV_EXCL_START - out of memory cannot be provoked in the tests
+        return nullptr;
+    }  // LCOV_EXCL_STOP
+}
+
+void spline_se3_destroy(SplineSe3* const spline) { delete spline; }
+
+size_t spline_se3_num_knots(SplineSe3 const* const spline) {
+    return (spline == nullptr) ? 0 : spline->spline.NumKnots();
+}
+
+int spline_se3_add_knots(SplineSe3* const spline, size_t const count, double const* const poses,
+                         ptrdiff_t const pose_stride) {
+    if (count == 0) {
+        return SPLINE_OK;
+    }
+    if (spline == nullptr or poses == nullptr) {
+        return SPLINE_ERROR_NULL_POINTER;
+    }
+
+    try {
+        // The caller's stride is arbitrary, so the poses are first gathered into the layout that the bulk
+        // Se3Spline::AddKnots() takes - it then grows the knot storage at most once for the whole call.
+        std::vector<Eigen::Isometry3d> knots(count);
+        for (size_t i{0}; i < count; ++i) {
+            knots[i].matrix() = Eigen::Map<PoseMatrix const>(poses + static_cast<ptrdiff_t>(i) * pose_stride);
+        }
+        spline->spline.AddKnots(std::data(knots), count);
+    } catch (std::bad_alloc const&) {  // LCOV_EXCL_START
+        return SPLINE_ERROR_OUT_OF_MEMORY;
+    }  // LCOV_EXCL_STOP
+
+    return SPLINE_OK;
+}
+
+int64_t spline_se3_evaluate(SplineSe3 const* const spline, size_t const count, uint64_t const* const t_ns,
+                            ptrdiff_t const t_stride, double* const poses, ptrdiff_t const pose_stride,
+                            uint8_t* const valid_mask) {
+    if (spline == nullptr) {
+        return SPLINE_ERROR_NULL_POINTER;
+    }
+
+    return EvaluateBatch(count, t_ns, t_stride, poses, pose_stride, valid_mask,
+                         [spline](uint64_t const t_i, double* const pose_i) {
+                             auto const pose{spline->spline.Evaluate(t_i)};
+                             if (not pose.has_value()) {
+                                 return false;
+                             }
+                             Eigen::Map<PoseMatrix> output{pose_i};
+                             output = pose->matrix();
+                             return true;
+                         });
+}
+
+int64_t spline_se3_evaluate_velocity(SplineSe3 const* const spline, size_t const count, uint64_t const* const t_ns,
+                                     ptrdiff_t const t_stride, double* const velocities,
+                                     ptrdiff_t const velocity_stride, uint8_t* const valid_mask) {
+    if (spline == nullptr) {
+        return SPLINE_ERROR_NULL_POINTER;
+    }
+
+    return EvaluateBatch(count, t_ns, t_stride, velocities, velocity_stride, valid_mask,
+                         [spline](uint64_t const t_i, double* const velocity_i) {
+                             auto const velocity{spline->spline.EvaluateVelocity(t_i)};
+                             if (not velocity.has_value()) {
+                                 return false;
+                             }
+                             Eigen::Map<Vector6d> output{velocity_i};
+                             output = velocity.value();
+                             return true;
+                         });
+}
+
+int64_t spline_se3_evaluate_acceleration(SplineSe3 const* const spline, size_t const count,
+                                         uint64_t const* const t_ns, ptrdiff_t const t_stride,
+                                         double* const accelerations, ptrdiff_t const acceleration_stride,
+                                         uint8_t* const valid_mask) {
+    if (spline == nullptr) {
+        return SPLINE_ERROR_NULL_POINTER;
+    }
+
+    return EvaluateBatch(count, t_ns, t_stride, accelerations, acceleration_stride, valid_mask,
+                         [spline](uint64_t const t_i, double* const acceleration_i) {
+                             auto const acceleration{spline->spline.EvaluateAcceleration(t_i)};
+                             if (not acceleration.has_value()) {
+                                 return false;
+                             }
+                             Eigen::Map<Vector6d> output{acceleration_i};
+                             output = acceleration.value();
+                             return true;
+                         });
+}
+
+}  // extern "C"
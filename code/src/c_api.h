@@ -0,0 +1,59 @@
+#pragma once
+
+// Plain C interface to the Se3Spline, for consumers that cannot link against C++ directly (ex. Python via ctypes/cffi
+// or Rust via bindgen). All batch functions read their inputs from and write their results to caller owned buffers,
+// so that they can operate directly on numpy/ndarray memory without any copies and without allocating per call.
+//
+// Buffer layout conventions:
+//   - A pose is a row major 4x4 homogeneous transformation matrix (16 contiguous doubles).
+//   - A velocity is the twist [omega; v] and an acceleration its derivative [alpha; a], each six contiguous doubles.
+//     omega is the angular velocity with dR/dt = Hat(omega) * R and v = dp/dt - see Se3Spline::EvaluateVelocity().
+//   - Every stride counts elements of the buffer's own type (NOT bytes) between the start of consecutive entries, so
+//     a tightly packed (N, 4, 4) array of poses has a stride of 16 and a tightly packed (N,) array of times a stride
+//     of 1.
+//   - The validity mask has one bit per timestamp, bit i % 8 of byte i / 8 (i.e. little endian bit order, as in
+//     numpy.unpackbits(..., bitorder="little")), and must be at least (count + 7) / 8 bytes long. Invalid entries
+//     (ex. a time before the first or after the last valid segment) have their bit cleared and their output left
+//     untouched.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct SplineSe3 SplineSe3;
+
+// Error codes returned (as negative values) by the functions below.
+enum SplineStatus {
+    SPLINE_OK = 0,
+    SPLINE_ERROR_NULL_POINTER = -1,
+    SPLINE_ERROR_OUT_OF_MEMORY = -2,
+};
+
+// Returns NULL if the allocation failed. The spline must be released with spline_se3_destroy().
+SplineSe3* spline_se3_create(uint64_t t0_ns, uint64_t delta_t_ns);
+
+void spline_se3_destroy(SplineSe3* spline);
+
+size_t spline_se3_num_knots(SplineSe3 const* spline);
+
+// Appends count knots, each a pose in the layout described above. The rotation part is not checked for validity.
+int spline_se3_add_knots(SplineSe3* spline, size_t count, double const* poses, ptrdiff_t pose_stride);
+
+// The batch evaluation functions return the number of valid results, or a negative SplineStatus on error. The
+// timestamps do not have to be sorted.
+int64_t spline_se3_evaluate(SplineSe3 const* spline, size_t count, uint64_t const* t_ns, ptrdiff_t t_stride,
+                            double* poses, ptrdiff_t pose_stride, uint8_t* valid_mask);
+
+int64_t spline_se3_evaluate_velocity(SplineSe3 const* spline, size_t count, uint64_t const* t_ns, ptrdiff_t t_stride,
+                                     double* velocities, ptrdiff_t velocity_stride, uint8_t* valid_mask);
+
+int64_t spline_se3_evaluate_acceleration(SplineSe3 const* spline, size_t count, uint64_t const* t_ns,
+                                         ptrdiff_t t_stride, double* accelerations, ptrdiff_t acceleration_stride,
+                                         uint8_t* valid_mask);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,198 @@
+// Test harness for the C interface - written in plain C (instead of gtest) so that it also proves that c_api.h compiles
+// and links as C.
+
+#include "c_api.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static int num_failures = 0;
+
+#define EXPECT(condition)                                                           \
+    do {                                                                            \
+        if (!(condition)) {                                                         \
+            fprintf(stderr, "%s:%d: EXPECT(%s)\n", __FILE__, __LINE__, #condition); \
+            ++num_failures;                                                         \
+        }                                                                           \
+    } while (0)
+
+static int Near(double const a, double const b) { return fabs(a - b) < 1e-9; }
+
+static int Bit(uint8_t const* const mask, size_t const i) { return (mask[i / 8] >> (i % 8)) & 1; }
+
+// Same knots as the r3Spline tests, knot i is translated by (i, i, i) and not rotated, so that at t = 100 + 5 * s the
+// position is (1 + s, 1 + s, 1 + s) and the linear velocity (0.2, 0.2, 0.2).
+static SplineSe3* LinearSpline(size_t const num_knots) {
+    SplineSe3* const spline = spline_se3_create(100, 5);
+    EXPECT(spline != NULL);
+
+    // Packed inside a larger buffer with stride 20 to exercise the input stride
+    double knots[20 * 8];
+    memset(knots, 0, sizeof(knots));
+    for (size_t i = 0; i < num_knots; ++i) {
+        double* const knot = knots + 20 * i;
+        knot[0] = knot[5] = knot[10] = knot[15] = 1;
+        knot[3] = knot[7] = knot[11] = (double)i;
+    }
+    EXPECT(spline_se3_add_knots(spline, num_knots, knots, 20) == SPLINE_OK);
+    EXPECT(spline_se3_num_knots(spline) == num_knots);
+
+    return spline;
+}
+
+static void TestEvaluate(void) {
+    SplineSe3* const spline = LinearSpline(5);
+
+    // Two valid segments cover [100, 110), everything else is invalid. The times are read with stride 2.
+    uint64_t const t_ns[] = {100, 0, 99, 0, 105, 0, 107, 0, 110, 0, 1000, 0, 109, 0, 102, 0, 101};
+    size_t const count = 9;
+    int const expected_valid[] = {1, 0, 1, 1, 0, 0, 1, 1, 1};
+
+    double poses[9 * 18];
+    for (size_t i = 0; i < sizeof(poses) / sizeof(poses[0]); ++i) {
+        poses[i] = -42;
+    }
+    uint8_t mask[2] = {0xff, 0xff};
+
+    EXPECT(spline_se3_evaluate(spline, count, t_ns, 2, poses, 18, mask) == 6);
+    EXPECT(mask[1] == 0x01);  // Bits past count are cleared
+    for (size_t i = 0; i < count; ++i) {
+        double const* const pose = poses + 18 * i;
+        EXPECT(Bit(mask, i) == expected_valid[i]);
+        if (!expected_valid[i]) {
+            EXPECT(pose[0] == -42 && pose[15] == -42);  // Untouched
+            continue;
+        }
+
+        double const s = (double)(t_ns[2 * i] - 100) / 5;
+        EXPECT(Near(pose[3], 1 + s) && Near(pose[7], 1 + s) && Near(pose[11], 1 + s));
+        EXPECT(Near(pose[0], 1) && Near(pose[5], 1) && Near(pose[10], 1) && Near(pose[15], 1));
+        EXPECT(Near(pose[1], 0) && Near(pose[12], 0));
+        EXPECT(pose[16] == -42 && pose[17] == -42);  // Padding between the strided entries is untouched
+    }
+
+    spline_se3_destroy(spline);
+}
+
+static void TestEvaluateDerivatives(void) {
+    SplineSe3* const spline = LinearSpline(4);
+
+    uint64_t const t_ns[] = {100, 103, 104, 105};
+    double velocities[4 * 6];
+    double accelerations[4 * 6];
+    uint8_t mask;
+
+    EXPECT(spline_se3_evaluate_velocity(spline, 4, t_ns, 1, velocities, 6, &mask) == 3);
+    EXPECT(mask == 0x07);
+    for (size_t i = 0; i < 3; ++i) {
+        double const* const velocity = velocities + 6 * i;
+        EXPECT(Near(velocity[0], 0) && Near(velocity[1], 0) && Near(velocity[2], 0));
+        EXPECT(Near(velocity[3], 0.2) && Near(velocity[4], 0.2) && Near(velocity[5], 0.2));
+    }
+
+    EXPECT(spline_se3_evaluate_acceleration(spline, 4, t_ns, 1, accelerations, 6, &mask) == 3);
+    EXPECT(mask == 0x07);
+    for (size_t i = 0; i < 3 * 6; ++i) {
+        EXPECT(Near(accelerations[i], 0));
+    }
+
+    spline_se3_destroy(spline);
+}
+
+// Rotation about the x axis by a followed by a rotation about the z axis by b, written into a row major 4x4 pose.
+static void RotatedKnot(double* const knot, double const a, double const b) {
+    double const ca = cos(a), sa = sin(a), cb = cos(b), sb = sin(b);
+    double const rotation[9] = {cb, -sb * ca, sb * sa, sb, cb * ca, -cb * sa, 0, sa, ca};
+
+    memset(knot, 0, 16 * sizeof(double));
+    for (size_t r = 0; r < 3; ++r) {
+        memcpy(knot + 4 * r, rotation + 3 * r, 3 * sizeof(double));
+    }
+    knot[15] = 1;
+}
+
+// The angular velocity must be the exact derivative of the evaluated rotation, also when the rotation axis changes
+// between the knots.
+static void TestEvaluateVelocityChangingAxis(void) {
+    SplineSe3* const spline = spline_se3_create(100, 1000);
+    double knots[4 * 16];
+    for (size_t i = 0; i < 4; ++i) {
+        RotatedKnot(knots + 16 * i, 0.3 * (double)i, 0.2 * (double)(i * i));
+    }
+    EXPECT(spline_se3_add_knots(spline, 4, knots, 16) == SPLINE_OK);
+
+    uint64_t const t_ns[] = {599, 600, 601};
+    double poses[3 * 16];
+    double velocity[6];
+    uint8_t mask;
+    EXPECT(spline_se3_evaluate(spline, 3, t_ns, 1, poses, 16, &mask) == 3);
+    EXPECT(spline_se3_evaluate_velocity(spline, 1, t_ns + 1, 1, velocity, 6, &mask) == 1);
+
+    // R(601) * R(599)^T is approximately I + Hat(2 * omega), so its skew symmetric part gives omega
+    double const* const plus = poses + 32;
+    double const* const minus = poses;
+    double delta_R[9];
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            delta_R[3 * r + c] = plus[4 * r] * minus[4 * c] + plus[4 * r + 1] * minus[4 * c + 1] +
+                                 plus[4 * r + 2] * minus[4 * c + 2];
+        }
+    }
+    double const numerical_omega[3] = {(delta_R[7] - delta_R[5]) / 4, (delta_R[2] - delta_R[6]) / 4,
+                                       (delta_R[3] - delta_R[1]) / 4};
+
+    double const norm = sqrt(velocity[0] * velocity[0] + velocity[1] * velocity[1] + velocity[2] * velocity[2]);
+    EXPECT(norm > 0);
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT(fabs(velocity[i] - numerical_omega[i]) < 1e-4 * norm);
+    }
+
+    spline_se3_destroy(spline);
+}
+
+static void TestErrors(void) {
+    uint64_t const t_ns = 100;
+    double pose[16];
+    uint8_t mask;
+
+    EXPECT(spline_se3_evaluate(NULL, 1, &t_ns, 1, pose, 16, &mask) == SPLINE_ERROR_NULL_POINTER);
+    EXPECT(spline_se3_evaluate_velocity(NULL, 1, &t_ns, 1, pose, 6, &mask) == SPLINE_ERROR_NULL_POINTER);
+    EXPECT(spline_se3_evaluate_acceleration(NULL, 1, &t_ns, 1, pose, 6, &mask) == SPLINE_ERROR_NULL_POINTER);
+    EXPECT(spline_se3_add_knots(NULL, 1, pose, 16) == SPLINE_ERROR_NULL_POINTER);
+    EXPECT(spline_se3_num_knots(NULL) == 0);
+
+    SplineSe3* const spline = spline_se3_create(100, 5);
+    EXPECT(spline_se3_evaluate(spline, 1, &t_ns, 1, NULL, 16, &mask) == SPLINE_ERROR_NULL_POINTER);
+    EXPECT(spline_se3_evaluate_velocity(spline, 1, &t_ns, 1, pose, 6, NULL) == SPLINE_ERROR_NULL_POINTER);
+    EXPECT(spline_se3_evaluate_acceleration(spline, 1, &t_ns, 1, pose, 6, NULL) == SPLINE_ERROR_NULL_POINTER);
+    EXPECT(spline_se3_add_knots(spline, 1, NULL, 16) == SPLINE_ERROR_NULL_POINTER);
+
+    // Nothing to do is not an error, even with NULL buffers
+    EXPECT(spline_se3_evaluate(spline, 0, NULL, 1, NULL, 16, NULL) == 0);
+    EXPECT(spline_se3_evaluate_velocity(spline, 0, NULL, 1, NULL, 6, NULL) == 0);
+    EXPECT(spline_se3_evaluate_acceleration(spline, 0, NULL, 1, NULL, 6, NULL) == 0);
+    EXPECT(spline_se3_add_knots(spline, 0, NULL, 16) == SPLINE_OK);
+    EXPECT(spline_se3_num_knots(spline) == 0);
+
+    EXPECT(spline_se3_evaluate(spline, 1, &t_ns, 1, pose, 16, &mask) == 0);
+    EXPECT(mask == 0);
+    spline_se3_destroy(spline);
+
+    spline_se3_destroy(NULL);
+}
+
+int main(void) {
+    TestEvaluate();
+    TestEvaluateDerivatives();
+    TestEvaluateVelocityChangingAxis();
+    TestErrors();
+
+    if (num_failures != 0) {
+        fprintf(stderr, "%d expectation(s) failed\n", num_failures);  // LCOV_EXCL_START
+        return 1;
+    }  // LCOV_EXCL_STOP
+    printf("All c_api tests passed\n");
+
+    return 0;
+}
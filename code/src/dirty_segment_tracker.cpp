@@ -0,0 +1,78 @@
+#include "dirty_segment_tracker.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace reprojection_calibration::spline {
+
+DirtySegmentTracker::DirtySegmentTracker(int const k)
+    : k_{k}, version_{0}, cleared_version_{0}, tail_version_{0} {
+    assert(k >= 1);
+}
+
+void DirtySegmentTracker::MarkKnots(int const first, int const last) {
+    assert(0 <= first and first <= last);
+    if (first == last) {
+        return;
+    }
+
+    int const first_segment{std::max(0, first - k_ + 1)};
+    int const last_segment{last};  // Exclusive
+
+    ++version_;
+    if (std::size(segment_versions_) < static_cast<size_t>(last_segment)) {
+        segment_versions_.resize(last_segment, tail_version_);
+    }
+    std::fill(std::begin(segment_versions_) + first_segment, std::begin(segment_versions_) + last_segment, version_);
+}
+
+void DirtySegmentTracker::MarkKnotsFrom(int const first) {
+    assert(0 <= first);
+
+    int const first_segment{std::max(0, first - k_ + 1)};
+
+    ++version_;
+    if (std::size(segment_versions_) < static_cast<size_t>(first_segment)) {
+        segment_versions_.resize(first_segment, tail_version_);
+    }
+    std::fill(std::begin(segment_versions_) + first_segment, std::end(segment_versions_), version_);
+    tail_version_ = version_;
+}
+
+uint64_t DirtySegmentTracker::Version() const { return version_; }
+
+std::vector<int> DirtySegmentTracker::DirtySegments(size_t const num_knots, uint64_t const since_version) const {
+    if (num_knots < static_cast<size_t>(k_)) {
+        return {};
+    }
+    int const num_segments{static_cast<int>(num_knots) - k_ + 1};
+
+    std::vector<int> segments;
+    for (int i{0}; i < num_segments; ++i) {
+        if (IsDirty(i, since_version)) {
+            segments.push_back(i);
+        }
+    }
+
+    return segments;
+}
+
+bool DirtySegmentTracker::IsDirty(int const segment, uint64_t const since_version) const {
+    assert(0 <= segment);
+
+    uint64_t const segment_version{static_cast<size_t>(segment) < std::size(segment_versions_)
+                                       ? segment_versions_[segment]
+                                       : tail_version_};
+
+    return segment_version > since_version;
+}
+
+std::vector<int> DirtySegmentTracker::DirtySegments(size_t const num_knots) const {
+    return DirtySegments(num_knots, cleared_version_);
+}
+
+bool DirtySegmentTracker::IsDirty(int const segment) const { return IsDirty(segment, cleared_version_); }
+
+void DirtySegmentTracker::Clear() { cleared_version_ = version_; }
+
+}  // namespace reprojection_calibration::spline
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace reprojection_calibration::spline {
+
+// Keeps track of which spline segments were touched by knot edits, so that derived data (precomputed coefficients,
+// so(3) increments, lookup tables etc.) only needs to be recomputed for those segments.
+//
+// From reference [1] - "At time t in [t_i, t_i+1) the value of p(t) only depends on the control points p_i, p_i+1,
+// ..., p_i+k-1". Flipping that around means that knot j influences the k segments j-k+1, ..., j, and those are the
+// only segments we mark as dirty when knot j changes.
+//
+// Every edit increments a version counter and stamps the segments it touches with the new version. A consumer (ex.
+// ArcLengthIndex or So3SegmentCache) records Version() when it syncs and later asks for the segments that changed since
+// then, so any number of caches can follow the same spline independently and nobody has to clear anything. The
+// DirtySegments()/IsDirty() overloads without a version are relative to the last Clear(), for a single owner.
+class DirtySegmentTracker {
+   public:
+    explicit DirtySegmentTracker(int const k);
+
+    // Marks all segments influenced by the knots in the half open interval [first, last).
+    void MarkKnots(int const first, int const last);
+
+    // Inserting or erasing a knot shifts the index of all knots after it, therefore every segment that touches the
+    // knot at index first or any knot after it is invalidated.
+    void MarkKnotsFrom(int const first);
+
+    uint64_t Version() const;
+
+    // Returns the sorted indices of the segments, valid for a spline with num_knots knots, that were touched by an
+    // edit after since_version.
+    std::vector<int> DirtySegments(size_t const num_knots, uint64_t const since_version) const;
+
+    bool IsDirty(int const segment, uint64_t const since_version) const;
+
+    std::vector<int> DirtySegments(size_t const num_knots) const;
+
+    bool IsDirty(int const segment) const;
+
+    void Clear();
+
+   private:
+    int k_;
+    uint64_t version_;                       // Incremented by every edit
+    uint64_t cleared_version_;               // Version at the last Clear()
+    std::vector<uint64_t> segment_versions_;  // Version of the last edit that touched each segment
+    uint64_t tail_version_;                  // Version of all segments at or after the end of segment_versions_
+};
+
+}  // namespace reprojection_calibration::spline
@@ -0,0 +1,74 @@
+#include "dirty_segment_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include "constants.hpp"
+
+using namespace reprojection_calibration::spline;
+
+TEST(DirtySegmentTracker, TestMarkKnots) {
+    DirtySegmentTracker tracker{constants::k};
+    EXPECT_TRUE(tracker.DirtySegments(10).empty());
+
+    // Knot 5 influences the k=4 segments 2, 3, 4 and 5
+    tracker.MarkKnots(5, 6);
+    EXPECT_EQ(tracker.DirtySegments(10), (std::vector<int>{2, 3, 4, 5}));
+
+    // With only seven knots there are only four valid segments, so segment 4 and 5 do not exist yet
+    EXPECT_EQ(tracker.DirtySegments(7), (std::vector<int>{2, 3}));
+
+    // The first knot only influences the first segment
+    tracker.MarkKnots(0, 1);
+    EXPECT_EQ(tracker.DirtySegments(10), (std::vector<int>{0, 2, 3, 4, 5}));
+
+    tracker.Clear();
+    EXPECT_TRUE(tracker.DirtySegments(10).empty());
+}
+
+TEST(DirtySegmentTracker, TestMarkKnotsFrom) {
+    DirtySegmentTracker tracker{constants::k};
+
+    // Inserting/erasing at knot 5 shifts all later knots - every segment that touches knot 5 or later is dirty
+    tracker.MarkKnotsFrom(5);
+    EXPECT_EQ(tracker.DirtySegments(10), (std::vector<int>{2, 3, 4, 5, 6}));
+    EXPECT_TRUE(tracker.IsDirty(100));
+    EXPECT_FALSE(tracker.IsDirty(1));
+
+    // Not enough knots for even one segment
+    EXPECT_TRUE(tracker.DirtySegments(3).empty());
+}
+
+TEST(DirtySegmentTracker, TestMarkEmptyRange) {
+    DirtySegmentTracker tracker{constants::k};
+
+    // Nothing was edited, so nothing is dirty and the version does not move
+    tracker.MarkKnots(3, 3);
+    EXPECT_EQ(tracker.Version(), 0);
+    EXPECT_TRUE(tracker.DirtySegments(10).empty());
+}
+
+TEST(DirtySegmentTracker, TestVersions) {
+    DirtySegmentTracker tracker{constants::k};
+    EXPECT_EQ(tracker.Version(), 0);
+
+    tracker.MarkKnots(5, 6);
+    uint64_t const consumer_a{tracker.Version()};  // Consumer a syncs after the first edit, consumer b never did
+    uint64_t const consumer_b{0};
+
+    tracker.MarkKnots(0, 1);
+    tracker.MarkKnotsFrom(8);
+    EXPECT_EQ(tracker.DirtySegments(10, consumer_a), (std::vector<int>{0, 5, 6}));
+    EXPECT_EQ(tracker.DirtySegments(10, consumer_b), (std::vector<int>{0, 2, 3, 4, 5, 6}));
+    EXPECT_TRUE(tracker.IsDirty(100, consumer_a));
+
+    // Clearing for the single owner API does not hide anything from the consumers
+    tracker.Clear();
+    EXPECT_TRUE(tracker.DirtySegments(10).empty());
+    EXPECT_EQ(tracker.DirtySegments(10, consumer_a), (std::vector<int>{0, 5, 6}));
+
+    // A later edit in the middle does not reset the segments after it that MarkKnotsFrom() already covered
+    tracker.MarkKnots(2, 3);
+    EXPECT_EQ(tracker.DirtySegments(10), (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(tracker.DirtySegments(10, consumer_a), (std::vector<int>{0, 1, 2, 5, 6}));
+    EXPECT_TRUE(tracker.DirtySegments(10, tracker.Version()).empty());
+}
@@ -0,0 +1,541 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+
+#include "constants.hpp"
+#include "lie.hpp"
+#include "r3_spline.hpp"
+#include "relative_pose.hpp"
+#include "se3_spline.hpp"
+#include "se3_spline_bundle.hpp"
+#include "se3_spline_sampler.hpp"
+#include "so3_spline.hpp"
+#include "utilities.hpp"
+
+using namespace reprojection_calibration::spline;
+
+// Accuracy versus speed regression harness. Every evaluation path of the library is run over randomized (but seeded,
+// so reproducible) trajectories and compared against a long double transcription of the straightforward evaluation
+// code. For each path we print the max and RMS error together with the throughput, so that accuracy and speed
+// regressions of the fast paths show up side by side. The printed throughput is only meaningful in an optimized build!
+
+namespace {
+
+using Matrix3L = Eigen::Matrix<long double, 3, 3>;
+using Vector3L = Eigen::Matrix<long double, 3, 1>;
+using Vector6L = Eigen::Matrix<long double, 6, 1>;
+using MatrixKKL = Eigen::Matrix<long double, constants::k, constants::k>;
+using VectorKL = Eigen::Matrix<long double, constants::k, 1>;
+
+// The blending matrices are rational numbers with denominator (k-1)!, which we scale out so that the integer
+// numerators are exact and the division happens in long double.
+MatrixKKL ReferenceMatrix(Eigen::MatrixXd const& matrix) {
+    double const denominator{static_cast<double>(Factorial(constants::k - 1))};
+    return (matrix * denominator).array().round().matrix().cast<long double>() / denominator;
+}
+
+// Eigen goes through a quaternion here, which stays well conditioned all the way up to a rotation angle of pi.
+Matrix3L ReferenceExp(Vector3L const& phi) {
+    long double const angle{phi.norm()};
+    if (angle == 0) {
+        return Matrix3L::Identity();
+    }
+
+    return Eigen::AngleAxis<long double>{angle, phi / angle}.toRotationMatrix();
+}
+
+Vector3L ReferenceLog(Matrix3L const& R) {
+    Eigen::AngleAxis<long double> const angle_axis{R};
+    return angle_axis.angle() * angle_axis.axis();
+}
+
+struct ReferenceSpline {
+    std::tuple<long double, int> Position(uint64_t const t_ns) const {
+        long double const s_t{static_cast<long double>(t_ns - t0_ns) / delta_t_ns};
+        long double const i{std::floor(s_t)};
+
+        return {s_t - i, static_cast<int>(i)};
+    }
+
+    VectorKL U(long double const u_i, int const derivative) const {
+        VectorKL u{VectorKL::Zero()};
+        for (int j{derivative}; j < constants::k; ++j) {
+            u(j) = polynomial_coefficients(derivative, j) * std::pow(u_i, j - derivative);
+        }
+
+        return u / std::pow(static_cast<long double>(delta_t_ns), derivative);
+    }
+
+    Vector3L Position(uint64_t const t_ns, int const derivative) const {
+        auto const [u_i, i]{Position(t_ns)};
+
+        Eigen::Matrix<long double, 3, constants::k> P;
+        for (int j{0}; j < constants::k; ++j) {
+            P.col(j) = positions[i + j];
+        }
+
+        return P * M * U(u_i, derivative);
+    }
+
+    // Same recursion as So3Spline::EvaluateAcceleration() but all in long double and with a quaternion based Log().
+    std::tuple<Matrix3L, Vector3L, Vector3L> Rotation(uint64_t const t_ns) const {
+        auto const [u_i, i]{Position(t_ns)};
+        VectorKL const weight0{M_cumulative * U(u_i, 0)};
+        VectorKL const weight1{M_cumulative * U(u_i, 1)};
+        VectorKL const weight2{M_cumulative * U(u_i, 2)};
+
+        Matrix3L rotation{rotations[i]};
+        Vector3L velocity{Vector3L::Zero()};
+        Vector3L acceleration{Vector3L::Zero()};
+        for (int j{0}; j < (constants::k - 1); ++j) {
+            Vector3L const delta_phi{ReferenceLog(rotations[i + j].transpose() * rotations[i + j + 1])};
+            Matrix3L const delta_R{ReferenceExp(weight0[j + 1] * delta_phi)};
+            rotation = delta_R * rotation;
+
+            Vector3L const delta_v_j{weight1[j + 1] * delta_phi};
+            velocity = delta_v_j + (delta_R.transpose() * velocity);
+
+            Vector3L const delta_a_j{weight2[j + 1] * delta_phi + velocity.cross(delta_v_j)};
+            acceleration = delta_a_j + (delta_R.transpose() * acceleration);
+        }
+
+        return {rotation, velocity, acceleration};
+    }
+
+    // The exact derivatives of the rotation above from the forward recursion (see internal::EvaluateSo3Segment())
+    // together with the position derivatives, as the twist [omega; v] and its derivative [alpha; a].
+    std::tuple<Vector6L, Vector6L> Twist(uint64_t const t_ns) const {
+        auto const [u_i, i]{Position(t_ns)};
+        VectorKL const weight0{M_cumulative * U(u_i, 0)};
+        VectorKL const weight1{M_cumulative * U(u_i, 1)};
+        VectorKL const weight2{M_cumulative * U(u_i, 2)};
+
+        Vector3L omega{Vector3L::Zero()};
+        Vector3L alpha{Vector3L::Zero()};
+        for (int j{0}; j < (constants::k - 1); ++j) {
+            Vector3L const delta_phi{ReferenceLog(rotations[i + j].transpose() * rotations[i + j + 1])};
+            Matrix3L const delta_R{ReferenceExp(weight0[j + 1] * delta_phi)};
+
+            Vector3L const rotated_omega{delta_R * omega};
+            Vector3L const delta_omega{weight1[j + 1] * delta_phi};
+            alpha = delta_omega.cross(rotated_omega) + (delta_R * alpha) + (weight2[j + 1] * delta_phi);
+            omega = rotated_omega + delta_omega;
+        }
+
+        Vector6L twist;
+        twist << omega, Position(t_ns, 1);
+        Vector6L twist_derivative;
+        twist_derivative << alpha, Position(t_ns, 2);
+
+        return {twist, twist_derivative};
+    }
+
+    uint64_t t0_ns;
+    uint64_t delta_t_ns;
+    std::vector<Vector3L> positions;
+    std::vector<Matrix3L> rotations;
+    MatrixKKL M{ReferenceMatrix(BlendingMatrix(constants::k))};
+    MatrixKKL M_cumulative{ReferenceMatrix(CumulativeBlendingMatrix(constants::k))};
+    MatrixKKL polynomial_coefficients{PolynomialCoefficients(constants::k).cast<long double>()};
+};
+
+struct Scenario {
+    std::string name;
+    int num_knots;
+    uint64_t delta_t_ns;
+    double min_angle;  // Range of the rotation angle between consecutive knots
+    double max_angle;
+    // Regression thresholds relative to the magnitude of the evaluated quantity - one for the paths that involve a
+    // rotation and therefore Log(), and a separate one for the position only paths which never see its conditioning.
+    double max_error;
+    double max_position_error;
+};
+
+struct Trajectory {
+    Se3Spline se3_spline;
+    r3Spline r3_spline;
+    So3Spline so3_spline;
+    ReferenceSpline reference;
+};
+
+Trajectory RandomTrajectory(Scenario const& scenario, std::mt19937& generator) {
+    uint64_t const t0_ns{1'000'000};
+    Trajectory trajectory{Se3Spline{t0_ns, scenario.delta_t_ns}, r3Spline{t0_ns, scenario.delta_t_ns},
+                          So3Spline{t0_ns, scenario.delta_t_ns}, ReferenceSpline{t0_ns, scenario.delta_t_ns, {}, {}}};
+
+    std::normal_distribution<double> normal{0.0, 1.0};
+    std::uniform_real_distribution<double> angle{scenario.min_angle, scenario.max_angle};
+
+    Eigen::Isometry3d knot{Eigen::Isometry3d::Identity()};
+    for (int i{0}; i < scenario.num_knots; ++i) {
+        Eigen::Vector3d const axis{
+            Eigen::Vector3d{normal(generator), normal(generator), normal(generator)}.normalized()};
+        knot.linear() = knot.linear() * Exp(angle(generator) * axis);
+        knot.translation() += Eigen::Vector3d{normal(generator), normal(generator), normal(generator)};
+
+        trajectory.se3_spline.AddKnot(knot);
+        trajectory.r3_spline.knots_.push_back(knot.translation());
+        trajectory.so3_spline.knots_.push_back(knot.linear());
+        trajectory.reference.positions.push_back(knot.translation().cast<long double>());
+        trajectory.reference.rotations.push_back(knot.linear().cast<long double>());
+    }
+
+    return trajectory;
+}
+
+// Sorted, so that the batch paths see the same access pattern as a rolling shutter image or a dense resampling.
+std::vector<uint64_t> RandomTimes(Scenario const& scenario, int const num_samples, std::mt19937& generator) {
+    uint64_t const duration_ns{(scenario.num_knots - constants::k + 1) * scenario.delta_t_ns};
+    std::uniform_int_distribution<uint64_t> t{0, duration_ns - 1};
+
+    std::vector<uint64_t> t_ns(num_samples);
+    for (auto& t_ns_i : t_ns) {
+        t_ns_i = 1'000'000 + t(generator);
+    }
+    std::sort(std::begin(t_ns), std::end(t_ns));
+
+    return t_ns;
+}
+
+// The long double reference is much slower than any path under test, so it is only evaluated once per sample time.
+struct ReferenceSamples {
+    std::array<std::vector<Eigen::MatrixXd>, 3> positions;  // Indexed by derivative order
+    std::vector<Eigen::MatrixXd> rotations;
+    std::vector<Eigen::MatrixXd> velocities;
+    std::vector<Eigen::MatrixXd> accelerations;
+    std::vector<Eigen::MatrixXd> poses;
+    std::vector<Eigen::MatrixXd> twists;
+    std::vector<Eigen::MatrixXd> twist_derivatives;
+};
+
+ReferenceSamples EvaluateReference(ReferenceSpline const& reference, std::vector<uint64_t> const& t_ns) {
+    ReferenceSamples samples;
+    for (uint64_t const t_ns_i : t_ns) {
+        for (int derivative{0}; derivative < 3; ++derivative) {
+            samples.positions[derivative].push_back(reference.Position(t_ns_i, derivative).cast<double>());
+        }
+
+        auto const [rotation, velocity, acceleration]{reference.Rotation(t_ns_i)};
+        samples.rotations.push_back(rotation.cast<double>());
+        samples.velocities.push_back(velocity.cast<double>());
+        samples.accelerations.push_back(acceleration.cast<double>());
+
+        Eigen::Matrix4d pose{Eigen::Matrix4d::Identity()};
+        pose.topLeftCorner<3, 3>() = samples.rotations.back();
+        pose.topRightCorner<3, 1>() = samples.positions[0].back();
+        samples.poses.push_back(pose);
+
+        auto const [twist, twist_derivative]{reference.Twist(t_ns_i)};
+        samples.twists.push_back(twist.cast<double>());
+        samples.twist_derivatives.push_back(twist_derivative.cast<double>());
+    }
+
+    return samples;
+}
+
+// T_a^-1 * T_b and its twist, from the reference poses and twists of both splines. The formulas are the ones
+// documented in EvaluateRelativePose(), but here applied to the reference values.
+std::tuple<std::vector<Eigen::MatrixXd>, std::vector<Eigen::MatrixXd>> ReferenceRelativePoses(
+    ReferenceSamples const& a, ReferenceSamples const& b) {
+    std::vector<Eigen::MatrixXd> poses;
+    std::vector<Eigen::MatrixXd> twists;
+    for (size_t i{0}; i < std::size(a.poses); ++i) {
+        Eigen::Matrix4d const T_a{a.poses[i]};
+        Eigen::Matrix4d const T_b{b.poses[i]};
+        poses.push_back(T_a.inverse() * T_b);
+
+        Eigen::Matrix3d const R_a_inv{T_a.topLeftCorner<3, 3>().transpose()};
+        Eigen::Vector3d const delta_p{T_b.topRightCorner<3, 1>() - T_a.topRightCorner<3, 1>()};
+        Eigen::Vector3d const omega_a{a.twists[i].topRows(3)};
+        Vector6d twist;
+        twist << R_a_inv * (b.twists[i].topRows(3) - omega_a),
+            R_a_inv * (b.twists[i].bottomRows(3) - a.twists[i].bottomRows(3) - omega_a.cross(delta_p));
+        twists.push_back(twist);
+    }
+
+    return {poses, twists};
+}
+
+struct PathResult {
+    double max_error;
+    double rms_error;
+    double evaluations_per_second;
+};
+
+// Runs one evaluation path over all sample times, timing it, and then compares each element against the reference.
+// The errors are normalized by the largest reference magnitude so that positions, velocities and accelerations with
+// their very different units (meters, per nanosecond, per nanosecond squared) can share one threshold.
+template <typename T>
+PathResult RunPath(std::function<std::vector<std::optional<T>>()> const& path,
+                   std::vector<Eigen::MatrixXd> const& reference) {
+    auto const start{std::chrono::steady_clock::now()};
+    std::vector<std::optional<T>> const result{path()};
+    auto const end{std::chrono::steady_clock::now()};
+    EXPECT_EQ(std::size(result), std::size(reference));
+    if (std::size(result) != std::size(reference)) {
+        return {std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), 0};
+    }
+
+    double scale{0};
+    for (auto const& reference_i : reference) {
+        scale = std::max(scale, reference_i.norm());
+    }
+    scale = (scale > 0) ? scale : 1;
+
+    double max_error{0};
+    double sum_squared_error{0};
+    for (size_t i{0}; i < std::size(result); ++i) {
+        EXPECT_TRUE(result[i].has_value());
+        if (not result[i].has_value()) {
+            continue;
+        }
+        double const error{(Eigen::MatrixXd{result[i].value()} - reference[i]).norm() / scale};
+        max_error = std::max(max_error, error);
+        sum_squared_error += error * error;
+    }
+
+    double const seconds{std::chrono::duration<double>(end - start).count()};
+    return {max_error, std::sqrt(sum_squared_error / std::size(result)), std::size(result) / std::max(seconds, 1e-12)};
+}
+
+// Adapts a single timestamp evaluation method into a path over all sample times - this is the "per-row loop" that
+// the batch methods are measured against.
+template <typename T>
+std::function<std::vector<std::optional<T>>()> Loop(std::vector<uint64_t> const& t_ns,
+                                                     std::function<std::optional<T>(uint64_t)> const& evaluate) {
+    return [&t_ns, evaluate]() {
+        std::vector<std::optional<T>> result;
+        result.reserve(std::size(t_ns));
+        for (uint64_t const t_ns_i : t_ns) {
+            result.push_back(evaluate(t_ns_i));
+        }
+        return result;
+    };
+}
+
+using PosePair = Eigen::Matrix<double, 8, 4>;  // Two stacked 4x4 poses
+
+Eigen::Isometry3d KnotPose(Se3Spline const& spline, int const i) {
+    Eigen::Isometry3d knot{Eigen::Isometry3d::Identity()};
+    knot.linear() = spline.RotationSpline().knots_[i];
+    knot.translation() = spline.PositionSpline().knots_[i];
+
+    return knot;
+}
+
+std::optional<Eigen::Matrix4d> PoseMatrix(std::optional<Eigen::Isometry3d> const& pose) {
+    if (not pose.has_value()) {
+        return std::nullopt;
+    }
+
+    return pose->matrix();
+}
+
+void Report(Scenario const& scenario, std::string const& path, PathResult const& result) {
+    std::cout << std::left << std::setw(16) << scenario.name << std::setw(44) << path << std::right << std::scientific
+              << std::setprecision(2) << " max: " << result.max_error << " rms: " << result.rms_error
+              << " evals/s: " << result.evaluations_per_second << std::endl;
+
+    EXPECT_LT(result.max_error, scenario.max_error) << scenario.name << " - " << path;
+}
+
+void ReportPosition(Scenario const& scenario, std::string const& path, PathResult const& result) {
+    Report(scenario, path, result);
+    EXPECT_LT(result.max_error, scenario.max_position_error) << scenario.name << " - " << path;
+}
+
+}  // namespace
+
+TEST(EvaluationHarness, TestAccuracyAndThroughput) {
+    double const pi{M_PI};
+    std::vector<Scenario> const scenarios{
+        {"short_slow", 8, 5'000'000, 0.0, 0.01, 5e-12, 5e-12},
+        {"medium_fast", 64, 50'000'000, 0.1, 1.0, 5e-12, 5e-12},
+        {"long_dense", 512, 1'000'000, 0.0, 0.5, 5e-12, 5e-12},
+        {"sparse_fast", 64, 1'000'000'000, 1.0, 2.5, 5e-12, 5e-12},
+        // Rotations between knots of almost pi - this is where the sin(angle) division in Log() is worst conditioned
+        {"near_pi", 64, 50'000'000, pi - 1e-3, pi - 1e-5, 1e-5, 5e-12},
+    };
+
+    std::mt19937 generator{42};
+    int const num_samples{500};
+    for (auto const& scenario : scenarios) {
+        Trajectory const trajectory{RandomTrajectory(scenario, generator)};
+        std::vector<uint64_t> const t_ns{RandomTimes(scenario, num_samples, generator)};
+        ReferenceSamples const reference{EvaluateReference(trajectory.reference, t_ns)};
+
+        r3Spline const& r3_spline{trajectory.r3_spline};
+        for (auto const derivative : {DerivativeOrder::Null, DerivativeOrder::First, DerivativeOrder::Second}) {
+            std::string const order{std::to_string(static_cast<int>(derivative))};
+            auto const evaluate{[&](uint64_t const t) { return r3_spline.Evaluate(t, derivative); }};
+
+            ReportPosition(scenario, "r3Spline::Evaluate(t, " + order + ")",
+                   RunPath<VectorD>(Loop<VectorD>(t_ns, evaluate), reference.positions[static_cast<int>(derivative)]));
+            ReportPosition(scenario, "r3Spline::Evaluate(t_ns, " + order + ")",
+                   RunPath<VectorD>([&]() { return r3_spline.Evaluate(t_ns, derivative); },
+                                    reference.positions[static_cast<int>(derivative)]));
+        }
+
+        So3Spline const& so3_spline{trajectory.so3_spline};
+        Report(scenario, "So3Spline::Evaluate(t)",
+               RunPath<Eigen::Matrix3d>(
+                   Loop<Eigen::Matrix3d>(t_ns, [&](uint64_t const t) { return so3_spline.Evaluate(t); }),
+                   reference.rotations));
+        Report(scenario, "So3Spline::Evaluate(t_ns)",
+               RunPath<Eigen::Matrix3d>([&]() { return so3_spline.Evaluate(t_ns); }, reference.rotations));
+        Report(scenario, "So3Spline::EvaluateVelocity(t)",
+               RunPath<Eigen::Vector3d>(
+                   Loop<Eigen::Vector3d>(t_ns, [&](uint64_t const t) { return so3_spline.EvaluateVelocity(t); }),
+                   reference.velocities));
+        Report(scenario, "So3Spline::EvaluateAcceleration(t)",
+               RunPath<Eigen::Vector3d>(
+                   Loop<Eigen::Vector3d>(t_ns, [&](uint64_t const t) { return so3_spline.EvaluateAcceleration(t); }),
+                   reference.accelerations));
+
+        Se3Spline const& se3_spline{trajectory.se3_spline};
+        auto const evaluate_pose{[&](uint64_t const t) { return PoseMatrix(se3_spline.Evaluate(t)); }};
+        Report(scenario, "Se3Spline::Evaluate(t)",
+               RunPath<Eigen::Matrix4d>(Loop<Eigen::Matrix4d>(t_ns, evaluate_pose), reference.poses));
+
+        Report(scenario, "Se3Spline::EvaluateVelocity(t)",
+               RunPath<Vector6d>(
+                   Loop<Vector6d>(t_ns, [&](uint64_t const t) { return se3_spline.EvaluateVelocity(t); }),
+                   reference.twists));
+        Report(scenario, "Se3Spline::EvaluateAcceleration(t)",
+               RunPath<Vector6d>(
+                   Loop<Vector6d>(t_ns, [&](uint64_t const t) { return se3_spline.EvaluateAcceleration(t); }),
+                   reference.twist_derivatives));
+
+        // The time offset path at zero offset, so that it can share the reference with everything else
+        auto const evaluate_with_time_offset{[&]() {
+            std::vector<std::optional<Eigen::Matrix4d>> poses;
+            std::vector<std::optional<Vector6d>> twists;
+            for (uint64_t const t_ns_i : t_ns) {
+                auto const result{se3_spline.EvaluateWithTimeOffset(t_ns_i, 0.0)};
+                poses.push_back(result.has_value() ? std::optional{std::get<0>(*result).matrix()} : std::nullopt);
+                twists.push_back(result.has_value() ? std::optional{std::get<1>(*result)} : std::nullopt);
+            }
+            return std::tuple{poses, twists};
+        }};
+        Report(scenario, "Se3Spline::EvaluateWithTimeOffset pose",
+               RunPath<Eigen::Matrix4d>([&]() { return std::get<0>(evaluate_with_time_offset()); }, reference.poses));
+        Report(scenario, "Se3Spline::EvaluateWithTimeOffset twist",
+               RunPath<Vector6d>([&]() { return std::get<1>(evaluate_with_time_offset()); }, reference.twists));
+
+        // One rolling shutter frame that spans the whole valid time range of the spline, so that the row times can be
+        // checked against the same reference as everything else.
+        uint64_t const line_delay_ns{(t_ns.back() - t_ns.front()) / (num_samples - 1)};
+        std::vector<uint64_t> row_t_ns(num_samples);
+        for (int r{0}; r < num_samples; ++r) {
+            row_t_ns[r] = t_ns.front() + r * line_delay_ns;
+        }
+        ReferenceSamples const reference_rows{EvaluateReference(trajectory.reference, row_t_ns)};
+        std::vector<Eigen::MatrixXd> const& reference_row_poses{reference_rows.poses};
+        Report(scenario, "Se3Spline::Evaluate(t) per row",
+               RunPath<Eigen::Matrix4d>(Loop<Eigen::Matrix4d>(row_t_ns, evaluate_pose), reference_row_poses));
+        Report(scenario, "Se3Spline::EvaluateRollingShutter",
+               RunPath<Eigen::Matrix4d>(
+                   [&]() {
+                       auto const poses{se3_spline.EvaluateRollingShutter(t_ns.front(), line_delay_ns, num_samples)};
+
+                       std::vector<std::optional<Eigen::Matrix4d>> result;
+                       std::transform(std::cbegin(poses), std::cend(poses), std::back_inserter(result), PoseMatrix);
+                       return result;
+                   },
+                   reference_row_poses));
+        Report(scenario, "Se3Spline::EvaluateRollingShutter twist",
+               RunPath<Vector6d>(
+                   [&]() {
+                       std::vector<std::optional<Vector6d>> twists;
+                       se3_spline.EvaluateRollingShutter(t_ns.front(), line_delay_ns, num_samples, &twists);
+                       return twists;
+                   },
+                   reference_rows.twists));
+
+        // The sampler over the same row times, in chunks that do not line up with the segments
+        auto const sample_rows{[&]() {
+            Se3SplineSampler sampler{
+                se3_spline, row_t_ns.front(), row_t_ns.back() + 1, line_delay_ns, 37, DerivativeOrder::Second};
+            std::vector<Se3Sample> samples;
+            while (not sampler.Done()) {
+                auto const& chunk{sampler.NextChunk()};
+                samples.insert(std::end(samples), std::cbegin(chunk), std::cend(chunk));
+            }
+            return samples;
+        }};
+        auto const sampler_path{[&](auto const& get) {
+            return [&, get]() {
+                std::vector<Se3Sample> const samples{sample_rows()};
+                std::vector<std::optional<std::decay_t<decltype(get(samples[0]))>>> result;
+                for (Se3Sample const& sample : samples) {
+                    result.push_back(get(sample));
+                }
+                return result;
+            };
+        }};
+        Report(scenario, "Se3SplineSampler pose",
+               RunPath<Eigen::Matrix4d>(
+                   sampler_path([](Se3Sample const& sample) -> Eigen::Matrix4d { return sample.pose.matrix(); }),
+                   reference_row_poses));
+        Report(scenario, "Se3SplineSampler velocity",
+               RunPath<Vector6d>(sampler_path([](Se3Sample const& sample) { return sample.velocity; }),
+                                 reference_rows.twists));
+        Report(scenario, "Se3SplineSampler acceleration",
+               RunPath<Vector6d>(sampler_path([](Se3Sample const& sample) { return sample.acceleration; }),
+                                 reference_rows.twist_derivatives));
+
+        // A second trajectory on the same time grid, so that EvaluateRelativePose() takes its shared segment path
+        Trajectory const trajectory_b{RandomTrajectory(scenario, generator)};
+        ReferenceSamples const reference_b{EvaluateReference(trajectory_b.reference, t_ns)};
+        auto const [reference_relative_poses, reference_relative_twists]{
+            ReferenceRelativePoses(reference, reference_b)};
+        auto const relative_poses{[&]() {
+            auto const relative{EvaluateRelativePose(se3_spline, trajectory_b.se3_spline, t_ns)};
+
+            std::vector<std::optional<Eigen::Matrix4d>> poses;
+            std::vector<std::optional<Vector6d>> twists;
+            for (auto const& relative_i : relative) {
+                poses.push_back(relative_i.has_value() ? std::optional{std::get<0>(*relative_i).matrix()}
+                                                       : std::nullopt);
+                twists.push_back(relative_i.has_value() ? std::optional{std::get<1>(*relative_i)} : std::nullopt);
+            }
+            return std::tuple{poses, twists};
+        }};
+        Report(scenario, "EvaluateRelativePose pose",
+               RunPath<Eigen::Matrix4d>([&]() { return std::get<0>(relative_poses()); }, reference_relative_poses));
+        Report(scenario, "EvaluateRelativePose twist",
+               RunPath<Vector6d>([&]() { return std::get<1>(relative_poses()); }, reference_relative_twists));
+
+        // Both trajectories as one bundle, where the result at each time is the two poses stacked on top of each other
+        Se3SplineBundle bundle{1'000'000, scenario.delta_t_ns, 2};
+        for (int i{0}; i < scenario.num_knots; ++i) {
+            bundle.AddKnots({KnotPose(se3_spline, i), KnotPose(trajectory_b.se3_spline, i)});
+        }
+        std::vector<Eigen::MatrixXd> reference_bundle_poses;
+        for (size_t i{0}; i < std::size(t_ns); ++i) {
+            PosePair poses;
+            poses << reference.poses[i], reference_b.poses[i];
+            reference_bundle_poses.push_back(poses);
+        }
+        auto const evaluate_bundle{[&](uint64_t const t) -> std::optional<PosePair> {
+            auto const poses{bundle.Evaluate(t)};
+            if (not poses.has_value()) {
+                return std::nullopt;
+            }
+
+            PosePair result;
+            result << poses->at(0).matrix(), poses->at(1).matrix();
+            return result;
+        }};
+        Report(scenario, "Se3SplineBundle::Evaluate(t)",
+               RunPath<PosePair>(Loop<PosePair>(t_ns, evaluate_bundle), reference_bundle_poses));
+    }
+}
@@ -43,4 +43,32 @@ Eigen::Matrix3d Hat(Eigen::Vector3d const& a) {
 
 Eigen::Vector3d Vee(Eigen::Matrix3d const& a_hat) { return Eigen::Vector3d{a_hat(2, 1), a_hat(0, 2), a_hat(1, 0)}; }
 
+ScaledExp::ScaledExp(Eigen::Vector3d const& phi)
+    : angle_{phi.norm()},
+      phi_hat_{Hat(phi)},
+      axis_axis_t_{Eigen::Matrix3d::Zero()},
+      axis_hat_{Eigen::Matrix3d::Zero()} {
+    if (angle_ > 0) {
+        Eigen::Vector3d const axis{phi / angle_};
+        axis_axis_t_ = axis * axis.transpose();
+        axis_hat_ = Hat(axis);
+    }
+}
+
+// Same as Exp() - note that a negative weight flips the axis, but because cos is even and sin is odd we can use the
+// signed angle directly.
+Eigen::Matrix3d ScaledExp::operator()(double const w) const {
+    double const angle{w * angle_};
+
+    if (std::abs(angle) < 1e-6) {
+        // use first order taylor expansion when phi is small
+        return Eigen::Matrix3d::Identity() + (w * phi_hat_);
+    }
+
+    double const cos{std::cos(angle)};
+    double const sin{std::sin(angle)};
+
+    return ((cos * Eigen::Matrix3d::Identity()) + ((1.0 - cos) * axis_axis_t_) + (sin * axis_hat_));
+}
+
 }  // namespace reprojection_calibration::spline
@@ -12,4 +12,21 @@ Eigen::Matrix3d Hat(Eigen::Vector3d const& a);
 
 Eigen::Vector3d Vee(Eigen::Matrix3d const& a_hat);
 
+// Evaluates Exp(w * phi) for a fixed phi and many different scalar weights w. The norm, axis and the matrices that only
+// depend on the axis are calculated once in the constructor, so that each evaluation only costs one sin/cos pair.
+class ScaledExp {
+   public:
+    ScaledExp() : ScaledExp(Eigen::Vector3d::Zero()) {}
+
+    explicit ScaledExp(Eigen::Vector3d const& phi);
+
+    Eigen::Matrix3d operator()(double const w) const;
+
+   private:
+    double angle_;
+    Eigen::Matrix3d phi_hat_;
+    Eigen::Matrix3d axis_axis_t_;
+    Eigen::Matrix3d axis_hat_;
+};
+
 }  // namespace reprojection_calibration::spline
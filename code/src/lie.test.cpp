@@ -64,3 +64,18 @@ TEST(Lie, TestHatOperators) {
     Eigen::Vector3d const a_hat_vee{Vee(a_hat)};  // Undo Hat() with Vee() to get back the starting vector
     EXPECT_TRUE(a_hat_vee.isApprox(a));
 }
+
+TEST(Lie, TestScaledExp) {
+    Eigen::Vector3d const phi{Eigen::Vector3d{0.1, -0.2, 0.3}};
+    ScaledExp const scaled_exp{phi};
+
+    for (double const w : {0.0, 1e-9, 0.25, 0.5, 1.0, -0.5, 4.0}) {
+        Eigen::Matrix3d const R{scaled_exp(w)};
+        EXPECT_TRUE(IsRotation(R));
+        EXPECT_TRUE(R.isApprox(Exp(w * phi)));
+    }
+
+    // Zero phi edge case where there is no well defined axis
+    ScaledExp const identity{Eigen::Vector3d::Zero()};
+    EXPECT_TRUE(identity(0.5).isApprox(Eigen::Matrix3d::Identity()));
+}
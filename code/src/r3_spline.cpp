@@ -6,10 +6,16 @@
 
 namespace reprojection_calibration::spline {
 
-r3Spline::r3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns) : time_handler_{t0_ns, delta_t_ns, constants::k} {}
+r3Spline::r3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns, std::pmr::memory_resource* const resource)
+    : knots_{resource}, time_handler_{t0_ns, delta_t_ns, constants::k}, tracker_{constants::k} {}
 
 std::optional<VectorD> r3Spline::Evaluate(uint64_t const t_ns, DerivativeOrder const derivative) const {
-    auto const normalized_position{time_handler_.SplinePosition(t_ns, std::size(knots_))};
+    return Evaluate(t_ns, 0.0, derivative);
+}
+
+std::optional<VectorD> r3Spline::Evaluate(uint64_t const t_ns, double const offset_ns,
+                                          DerivativeOrder const derivative) const {
+    auto const normalized_position{time_handler_.SplinePosition(t_ns, offset_ns, std::size(knots_))};
     if (not normalized_position.has_value()) {
         return std::nullopt;
     }
@@ -22,6 +28,35 @@ std::optional<VectorD> r3Spline::Evaluate(uint64_t const t_ns, DerivativeOrder c
     return (P * M * u) / std::pow(time_handler_.delta_t_ns_, static_cast<int>(derivative));
 }
 
+std::vector<std::optional<VectorD>> r3Spline::Evaluate(std::vector<uint64_t> const& t_ns,
+                                                      DerivativeOrder const derivative) const {
+    std::vector<std::optional<VectorD>> result;
+    result.reserve(std::size(t_ns));
+
+    static MatrixKK const M{BlendingMatrix(constants::k)};
+    double const scale{std::pow(time_handler_.delta_t_ns_, static_cast<int>(derivative))};
+
+    int segment{-1};
+    MatrixDK PM;
+    for (uint64_t const t_ns_i : t_ns) {
+        auto const normalized_position{time_handler_.SplinePosition(t_ns_i, std::size(knots_))};
+        if (not normalized_position.has_value()) {
+            result.push_back(std::nullopt);
+            continue;
+        }
+        auto const [u_i, i]{normalized_position.value()};
+
+        if (i != segment) {
+            segment = i;
+            PM = Eigen::Map<const MatrixDK>(knots_[i].data(), constants::d, constants::k) * M;
+        }
+
+        result.push_back((PM * r3Spline::CalculateU(u_i, derivative)) / scale);
+    }
+
+    return result;
+}  // LCOV_EXCL_LINE
+
 // We are constructing the column vectors u that we multiply by C as found at the top of page five in [2] - this
 // construction depends on which derivative of u we are evaluating the spline at.
 // TODO(Jack): We also can calculate std::pow(delta_t_ns, derivative_order) in the constructor ahead of time if we
@@ -32,11 +67,57 @@ VectorK r3Spline::CalculateU(double const u_i, DerivativeOrder const derivative)
     static MatrixKK const polynomial_coefficients{
         PolynomialCoefficients(constants::k)};  // Static means it only evaluates once :)
 
+    // Same as the coefficient-wise product of the coefficients with TimePolynomial(), but filled in directly so that
+    // the hot evaluation paths do not allocate a dynamic sized vector per call.
     int const derivative_order{static_cast<int>(derivative)};
-    VectorK const u{polynomial_coefficients.row(derivative_order).transpose().array() *
-                    TimePolynomial(constants::k, u_i, derivative_order).array()};
+    VectorK u{VectorK::Zero()};
+    double u_pow{1};
+    for (int j{derivative_order}; j < constants::k; ++j) {
+        u(j) = polynomial_coefficients(derivative_order, j) * u_pow;
+        u_pow *= u_i;
+    }
 
     return u;
 }
 
+void r3Spline::SetKnot(int const i, VectorD const& knot) {
+    assert(0 <= i and static_cast<size_t>(i) < std::size(knots_));
+
+    knots_[i] = knot;
+    tracker_.MarkKnots(i, i + 1);
+}
+
+void r3Spline::InsertKnot(int const i, VectorD const& knot) {
+    assert(0 <= i and static_cast<size_t>(i) <= std::size(knots_));
+
+    knots_.insert(std::begin(knots_) + i, knot);
+    tracker_.MarkKnotsFrom(i);
+}
+
+void r3Spline::EraseKnot(int const i) {
+    assert(0 <= i and static_cast<size_t>(i) < std::size(knots_));
+
+    knots_.erase(std::begin(knots_) + i);
+    tracker_.MarkKnotsFrom(i);
+}
+
+// The knots are stored contiguously (see how Evaluate() maps them into P) so the whole range can be written as one
+// vectorized block assignment instead of knot by knot.
+void r3Spline::UpdateKnots(int const first, Eigen::Ref<MatrixDX const> const& knots) {
+    int const n{static_cast<int>(knots.cols())};
+    assert(0 <= first and static_cast<size_t>(first + n) <= std::size(knots_));
+    if (n == 0) {
+        return;
+    }
+
+    Eigen::Map<MatrixDX>(knots_[first].data(), constants::d, n) = knots;
+    tracker_.MarkKnots(first, first + n);
+}
+
+DirtySegmentTracker const& r3Spline::Tracker() const { return tracker_; }
+
+TimeHandler const& r3Spline::Timing() const { return time_handler_; }
+
+void r3Spline::ClearDirtySegments() { tracker_.Clear(); }
+
 }  // namespace reprojection_calibration::spline
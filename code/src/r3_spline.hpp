@@ -1,7 +1,10 @@
 #pragma once
 
+#include <memory_resource>
 #include <optional>
+#include <vector>
 
+#include "dirty_segment_tracker.hpp"
 #include "types.hpp"
 #include "utilities.hpp"
 
@@ -13,19 +16,52 @@ namespace reprojection_calibration::spline {
 // does not make sense to make them part of the class and crowd the class scope.
 class r3Spline {
    public:
-    r3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns);
+    // The knots are allocated from the memory resource, ex. a std::pmr::monotonic_buffer_resource shared by many short
+    // lived splines so that they can all be released at once. The resource has to outlive the spline.
+    // WARN(Jack): A copy of the spline does NOT keep the resource - copy constructing a std::pmr container picks the
+    // default resource. To copy into the same arena construct the new spline with the resource and copy the knots.
+    r3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns,
+             std::pmr::memory_resource* const resource = std::pmr::get_default_resource());
 
     std::optional<VectorD> Evaluate(uint64_t const t_ns,
                                     DerivativeOrder const derivative = DerivativeOrder::Null) const;
 
+    // Evaluates at the time t_ns + offset_ns, where the offset can be fractional and negative.
+    std::optional<VectorD> Evaluate(uint64_t const t_ns, double const offset_ns,
+                                    DerivativeOrder const derivative = DerivativeOrder::Null) const;
+
+    // Batch version of Evaluate() - the product of the control points and the blending matrix is shared between
+    // consecutive timestamps that fall into the same segment.
+    std::vector<std::optional<VectorD>> Evaluate(std::vector<uint64_t> const& t_ns,
+                                                 DerivativeOrder const derivative = DerivativeOrder::Null) const;
+
     // TODO(Jack): Can we use this same method also for the rotation spline?
     static VectorK CalculateU(double const u_i, DerivativeOrder const derivative = DerivativeOrder::Null);
 
+    // Knot editing API - unlike writing to knots_ directly these methods record which segments were affected in the
+    // dirty segment tracker.
+    void SetKnot(int const i, VectorD const& knot);
+
+    void InsertKnot(int const i, VectorD const& knot);
+
+    void EraseKnot(int const i);
+
+    // Overwrites the contiguous range of knots starting at index first with the columns of knots.
+    void UpdateKnots(int const first, Eigen::Ref<MatrixDX const> const& knots);
+
+    DirtySegmentTracker const& Tracker() const;
+
+    TimeHandler const& Timing() const;
+
+    void ClearDirtySegments();
+
     // TODO(Jack): Let us consider what benefit we would get from making this private at some later point
-    std::vector<VectorD> knots_;  // A.k.a. "control points"
+    // WARN(Jack): Writing to the knots directly bypasses the dirty segment tracker!
+    std::pmr::vector<VectorD> knots_;  // A.k.a. "control points"
 
    private:
     TimeHandler time_handler_;
+    DirtySegmentTracker tracker_;
 };
 
 }  // namespace reprojection_calibration::spline
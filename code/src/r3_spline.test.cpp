@@ -98,4 +98,69 @@ TEST(r3Spline, Testr3SplineCalculate) {
     EXPECT_TRUE(u.isApprox(VectorK{1, 0.5, 0.25, 0.125}));
     EXPECT_TRUE(du.isApprox(VectorK{0, 1, 1, 0.75}));
     EXPECT_TRUE(dudu.isApprox(VectorK{0, 0, 2, 3}));
-}
\ No newline at end of file
+}
+
+TEST(r3Spline, Testr3SplineKnotEditing) {
+    r3Spline r3_spline{100, 5};
+    for (int i{0}; i < 8; ++i) {
+        r3_spline.InsertKnot(i, i * VectorD::Ones());
+    }
+    EXPECT_EQ(std::size(r3_spline.knots_), 8);
+    EXPECT_EQ(r3_spline.Tracker().DirtySegments(std::size(r3_spline.knots_)), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    r3_spline.ClearDirtySegments();
+    r3_spline.SetKnot(0, 10 * VectorD::Ones());
+    EXPECT_TRUE(r3_spline.knots_[0].isApproxToConstant(10));
+    EXPECT_EQ(r3_spline.Tracker().DirtySegments(std::size(r3_spline.knots_)), (std::vector<int>{0}));
+
+    // Contiguous bulk update of knots 3 to 5
+    r3_spline.ClearDirtySegments();
+    MatrixDX const update{MatrixDX::Constant(constants::d, 3, -1)};
+    r3_spline.UpdateKnots(3, update);
+    EXPECT_TRUE(r3_spline.knots_[2].isApproxToConstant(2));
+    EXPECT_TRUE(r3_spline.knots_[3].isApproxToConstant(-1));
+    EXPECT_TRUE(r3_spline.knots_[5].isApproxToConstant(-1));
+    EXPECT_TRUE(r3_spline.knots_[6].isApproxToConstant(6));
+    EXPECT_EQ(r3_spline.Tracker().DirtySegments(std::size(r3_spline.knots_)), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    r3_spline.ClearDirtySegments();
+    r3_spline.EraseKnot(6);
+    EXPECT_EQ(std::size(r3_spline.knots_), 7);
+    EXPECT_TRUE(r3_spline.knots_[6].isApproxToConstant(7));
+    EXPECT_EQ(r3_spline.Tracker().DirtySegments(std::size(r3_spline.knots_)), (std::vector<int>{3}));
+}
+
+TEST(r3Spline, Testr3SplineUpdateNoKnots) {
+    r3Spline r3_spline{100, 5};
+    for (int i{0}; i < 5; ++i) {
+        r3_spline.knots_.push_back(i * VectorD::Ones());
+    }
+
+    // An empty update (ex. an empty numpy array) is allowed, even at the very end, and changes nothing
+    r3_spline.UpdateKnots(5, MatrixDX{constants::d, 0});
+    EXPECT_EQ(r3_spline.Tracker().Version(), 0);
+    EXPECT_TRUE(r3_spline.knots_[4].isApproxToConstant(4));
+}
+
+TEST(r3Spline, Testr3SplineEvaluateBatch) {
+    r3Spline r3_spline{100, 5};
+    for (int i{0}; i < constants::k + 1; ++i) {
+        r3_spline.knots_.push_back(i * i * VectorD::Ones());
+    }
+
+    std::vector<uint64_t> const t_ns{100, 101, 104, 105, 109, 110};  // Crosses into the second segment
+    for (auto const derivative : {DerivativeOrder::Null, DerivativeOrder::First, DerivativeOrder::Second}) {
+        auto const batch{r3_spline.Evaluate(t_ns, derivative)};
+        ASSERT_EQ(std::size(batch), std::size(t_ns));
+
+        for (size_t i{0}; i < std::size(t_ns); ++i) {
+            auto const single{r3_spline.Evaluate(t_ns[i], derivative)};
+            ASSERT_EQ(batch[i].has_value(), single.has_value());
+            if (single.has_value()) {
+                EXPECT_TRUE(batch[i]->isApprox(single.value()));
+            }
+        }
+    }
+
+    EXPECT_EQ(r3_spline.Evaluate(std::vector<uint64_t>{110}).back(), std::nullopt);
+}
@@ -0,0 +1,111 @@
+#include "relative_pose.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "segment_kernels.hpp"
+#include "utilities.hpp"
+
+namespace reprojection_calibration::spline {
+
+namespace {
+
+// A pose together with its derivative, kept as separate rotation and translation parts so that the composition never
+// goes through a 4x4 matrix.
+struct MovingPose {
+    Eigen::Matrix3d R;
+    Eigen::Vector3d p;
+    Eigen::Vector3d omega;  // dR/dt = Hat(omega) * R
+    Eigen::Vector3d v;      // dp/dt = v
+};
+
+// Same values as Se3Spline::EvaluateWithTimeOffset(), but with the segment lookup and time polynomials provided from
+// outside so they are shared between both splines. The segment setup is only rebuilt when the segment changes.
+MovingPose EvaluateMovingPose(Se3Spline const& spline, int const i, std::array<VectorK, 3> const& u,
+                              internal::Se3Segment& segment) {
+    if (segment.rotation.i != i) {
+        segment = internal::Se3Segment{spline.PositionSpline().knots_, spline.RotationSpline().knots_, i};
+    }
+    internal::Se3Derivatives const pose{internal::EvaluateSe3Segment(segment, u, DerivativeOrder::First)};
+
+    return MovingPose{pose.R, pose.p, pose.omega, pose.v};
+}
+
+std::optional<MovingPose> EvaluateMovingPose(Se3Spline const& spline, uint64_t const t_ns) {
+    auto const result{spline.EvaluateWithTimeOffset(t_ns, 0.0)};
+    if (not result.has_value()) {
+        return std::nullopt;
+    }
+    auto const& [pose, twist]{result.value()};
+
+    return MovingPose{pose.linear(), pose.translation(), twist.topRows<3>(), twist.bottomRows<3>()};
+}
+
+// T * X for a constant X - the angular velocity is unchanged and the lever arm R * t_X adds omega x (R * t_X) to the
+// linear velocity.
+MovingPose ApplyExtrinsic(MovingPose const& T, Eigen::Isometry3d const& X) {
+    Eigen::Vector3d const lever_arm{T.R * X.translation()};
+
+    return MovingPose{T.R * X.linear(), T.p + lever_arm, T.omega, T.v + T.omega.cross(lever_arm)};
+}
+
+// T_a^-1 * T_b and its derivative. With R_ab = R_a^T * R_b and p_ab = R_a^T * (p_b - p_a) the product rule gives
+// omega_ab = R_a^T * (omega_b - omega_a) and v_ab = R_a^T * (v_b - v_a - omega_a x (p_b - p_a)).
+std::tuple<Eigen::Isometry3d, Vector6d> RelativeMovingPose(MovingPose const& T_a, MovingPose const& T_b) {
+    Eigen::Matrix3d const R_a_inv{T_a.R.transpose()};
+    Eigen::Vector3d const delta_p{T_b.p - T_a.p};
+
+    Eigen::Isometry3d pose{Eigen::Isometry3d::Identity()};
+    pose.linear() = R_a_inv * T_b.R;
+    pose.translation() = R_a_inv * delta_p;
+
+    Vector6d twist;
+    twist << R_a_inv * (T_b.omega - T_a.omega), R_a_inv * (T_b.v - T_a.v - T_a.omega.cross(delta_p));
+
+    return std::tuple{pose, twist};
+}
+
+}  // namespace
+
+std::vector<std::optional<std::tuple<Eigen::Isometry3d, Vector6d>>> EvaluateRelativePose(
+    Se3Spline const& spline_a, Se3Spline const& spline_b, std::vector<uint64_t> const& t_ns,
+    Eigen::Isometry3d const& extrinsic_a, Eigen::Isometry3d const& extrinsic_b) {
+    TimeHandler const& timing_a{spline_a.PositionSpline().Timing()};
+    TimeHandler const& timing_b{spline_b.PositionSpline().Timing()};
+    bool const same_grid{timing_a.t0_ns_ == timing_b.t0_ns_ and timing_a.delta_t_ns_ == timing_b.delta_t_ns_};
+    size_t const num_knots{std::min(spline_a.NumKnots(), spline_b.NumKnots())};
+
+    std::vector<std::optional<std::tuple<Eigen::Isometry3d, Vector6d>>> result;
+    result.reserve(std::size(t_ns));
+
+    internal::Se3Segment segment_a;
+    internal::Se3Segment segment_b;
+    for (uint64_t const t_ns_i : t_ns) {
+        std::optional<MovingPose> T_a;
+        std::optional<MovingPose> T_b;
+        if (same_grid) {
+            auto const normalized_position{timing_a.SplinePosition(t_ns_i, num_knots)};
+            if (normalized_position.has_value()) {
+                auto const [u_i, i]{normalized_position.value()};
+                auto const u{internal::TimeDerivatives(u_i, timing_a.delta_t_ns_, DerivativeOrder::First)};
+                T_a = EvaluateMovingPose(spline_a, i, u, segment_a);
+                T_b = EvaluateMovingPose(spline_b, i, u, segment_b);
+            }
+        } else {
+            T_a = EvaluateMovingPose(spline_a, t_ns_i);
+            T_b = EvaluateMovingPose(spline_b, t_ns_i);
+        }
+
+        if (not(T_a.has_value() and T_b.has_value())) {
+            result.push_back(std::nullopt);
+            continue;
+        }
+
+        result.push_back(
+            RelativeMovingPose(ApplyExtrinsic(T_a.value(), extrinsic_a), ApplyExtrinsic(T_b.value(), extrinsic_b)));
+    }
+
+    return result;
+}  // LCOV_EXCL_LINE
+
+}  // namespace reprojection_calibration::spline
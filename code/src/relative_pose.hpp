@@ -0,0 +1,29 @@
+#pragma once
+
+#include <Eigen/Geometry>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "se3_spline.hpp"
+#include "types.hpp"
+
+namespace reprojection_calibration::spline {
+
+// Evaluates the relative pose T_ab(t) = (T_a(t) * extrinsic_a)^-1 * (T_b(t) * extrinsic_b) between two trajectories
+// for each timestamp, ex. the pose of camera b in the frame of camera a when each trajectory is the pose of a rig body
+// and the extrinsics are the constant body to camera transforms.
+//
+// Together with the pose the twist [omega; v] of the relative pose is returned, following the same convention as
+// Se3Spline::EvaluateWithTimeOffset(), i.e. dR_ab/dt = Hat(omega) * R_ab and dp_ab/dt = v.
+//
+// When both splines have the same t0_ns and delta_t_ns the segment lookup and the blending weights are calculated once
+// per timestamp for all four underlying splines, and the Log() of the rotation knot increments is shared between
+// consecutive timestamps that fall into the same segment, so the timestamps should be sorted to get the most out of
+// it. The composition works on the rotations and translations directly instead of multiplying homogeneous matrices.
+std::vector<std::optional<std::tuple<Eigen::Isometry3d, Vector6d>>> EvaluateRelativePose(
+    Se3Spline const& spline_a, Se3Spline const& spline_b, std::vector<uint64_t> const& t_ns,
+    Eigen::Isometry3d const& extrinsic_a = Eigen::Isometry3d::Identity(),
+    Eigen::Isometry3d const& extrinsic_b = Eigen::Isometry3d::Identity());
+
+}  // namespace reprojection_calibration::spline
@@ -0,0 +1,104 @@
+#include "relative_pose.hpp"
+
+#include <gtest/gtest.h>
+
+#include "lie.hpp"
+
+using namespace reprojection_calibration::spline;
+
+Se3Spline RandomSe3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns, int const num_knots) {
+    Se3Spline spline{t0_ns, delta_t_ns};
+    for (int i{0}; i < num_knots; ++i) {
+        Eigen::Isometry3d knot{Eigen::Isometry3d::Identity()};
+        knot.rotate(Exp(Eigen::Vector3d::Random()));
+        knot.translation() = Eigen::Vector3d::Random();
+        spline.AddKnot(knot);
+    }
+
+    return spline;
+}
+
+Eigen::Isometry3d RandomExtrinsic() {
+    Eigen::Isometry3d extrinsic{Eigen::Isometry3d::Identity()};
+    extrinsic.rotate(Exp(Eigen::Vector3d::Random()));
+    extrinsic.translation() = Eigen::Vector3d::Random();
+
+    return extrinsic;
+}
+
+// Checks the poses against the plain homogeneous composition and the twists against a central finite difference of
+// those poses. The timestamps must be further than h from any segment boundary - with large increments between the
+// random knots the rotation spline is not exactly continuous across segments, because Evaluate() left multiplies the
+// body frame increments Log(R_j^-1 * R_j+1).
+void ExpectRelativePoseAndTwist(Se3Spline const& spline_a, Se3Spline const& spline_b,
+                                Eigen::Isometry3d const& extrinsic_a, Eigen::Isometry3d const& extrinsic_b,
+                                std::vector<uint64_t> const& t_ns) {
+    auto const reference{[&](uint64_t const t) -> std::optional<Eigen::Isometry3d> {
+        auto const T_a{spline_a.Evaluate(t)};
+        auto const T_b{spline_b.Evaluate(t)};
+        if (not(T_a.has_value() and T_b.has_value())) {
+            return std::nullopt;
+        }
+        return (T_a.value() * extrinsic_a).inverse() * (T_b.value() * extrinsic_b);
+    }};
+
+    auto const result{EvaluateRelativePose(spline_a, spline_b, t_ns, extrinsic_a, extrinsic_b)};
+    ASSERT_EQ(std::size(result), std::size(t_ns));
+
+    uint64_t const h{1000};
+    for (size_t n{0}; n < std::size(t_ns); ++n) {
+        auto const pose{reference(t_ns[n])};
+        ASSERT_EQ(result[n].has_value(), pose.has_value()) << "t_ns: " << t_ns[n];
+        if (not pose.has_value()) {
+            continue;
+        }
+        auto const& [T_ab, twist]{result[n].value()};
+        EXPECT_TRUE(T_ab.isApprox(pose.value()));
+
+        auto const pose_plus{reference(t_ns[n] + h)};
+        auto const pose_minus{reference(t_ns[n] - h)};
+        if (not(pose_plus.has_value() and pose_minus.has_value())) {
+            continue;
+        }
+        Eigen::Vector3d const numerical_omega{Log(pose_plus->linear() * pose_minus->linear().transpose()) / (2 * h)};
+        Eigen::Vector3d const numerical_v{(pose_plus->translation() - pose_minus->translation()) / (2 * h)};
+        EXPECT_TRUE(twist.topRows<3>().isApprox(numerical_omega, 1e-5));
+        EXPECT_TRUE(twist.bottomRows<3>().isApprox(numerical_v, 1e-5));
+    }
+}
+
+TEST(RelativePose, TestEvaluateRelativePoseSameGrid) {
+    uint64_t const delta_t_ns{1000000};
+    Se3Spline const spline_a{RandomSe3Spline(1000000, delta_t_ns, 6)};
+    Se3Spline const spline_b{RandomSe3Spline(1000000, delta_t_ns, 7)};
+
+    // Sorted, repeated segments, before the start and past the end of the shorter spline
+    std::vector<uint64_t> const t_ns{0, 1000000, 1200000, 1700000, 2100000, 2300000, 3500000, 3999999, 4000000};
+    ExpectRelativePoseAndTwist(spline_a, spline_b, Eigen::Isometry3d::Identity(), Eigen::Isometry3d::Identity(), t_ns);
+    ExpectRelativePoseAndTwist(spline_a, spline_b, RandomExtrinsic(), RandomExtrinsic(), t_ns);
+
+    // Unsorted timestamps jump back and forth between segments
+    std::vector<uint64_t> const unsorted_t_ns{3500000, 1200000, 2300000, 1700000};
+    ExpectRelativePoseAndTwist(spline_a, spline_b, RandomExtrinsic(), RandomExtrinsic(), unsorted_t_ns);
+}
+
+TEST(RelativePose, TestEvaluateRelativePoseDifferentGrid) {
+    Se3Spline const spline_a{RandomSe3Spline(1000000, 1000000, 6)};
+    Se3Spline const spline_b{RandomSe3Spline(1500000, 800000, 8)};
+
+    std::vector<uint64_t> const t_ns{1000000, 1400000, 1600000, 2750000, 3950000, 4100000, 6000000};
+    ExpectRelativePoseAndTwist(spline_a, spline_b, RandomExtrinsic(), RandomExtrinsic(), t_ns);
+}
+
+TEST(RelativePose, TestEvaluateRelativePoseSelf) {
+    Se3Spline const spline{RandomSe3Spline(0, 1000000, 5)};
+
+    // A trajectory relative to itself is the identity and does not move
+    auto const result{EvaluateRelativePose(spline, spline, {500000, 1500000})};
+    for (auto const& relative : result) {
+        ASSERT_TRUE(relative.has_value());
+        auto const& [T_ab, twist]{relative.value()};
+        EXPECT_TRUE(T_ab.isApprox(Eigen::Isometry3d::Identity()));
+        EXPECT_TRUE(twist.isZero(1e-12));
+    }
+}
@@ -0,0 +1,127 @@
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "se3_spline.hpp"
+
+using namespace reprojection_calibration::spline;
+
+// Build time and number of heap allocations of constructing Se3Splines knot by knot, with Reserve(), with the bulk
+// AddKnots() and from a std::pmr::monotonic_buffer_resource arena shared by many splines.
+//
+//      se3_spline.benchmark [num_knots]
+
+namespace {
+
+long num_allocations{0};
+
+}  // namespace
+
+// Counts every global heap allocation - the deletes have to be replaced as well to match
+void* operator new(size_t const size) {
+    ++num_allocations;
+    if (void* const memory{std::malloc(size)}; memory != nullptr) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(size_t const size, std::align_val_t const alignment) {
+    ++num_allocations;
+    size_t const align{static_cast<size_t>(alignment)};
+    if (void* const memory{std::aligned_alloc(align, ((size + align - 1) / align) * align)}; memory != nullptr) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* const memory) noexcept { std::free(memory); }
+
+void operator delete(void* const memory, size_t) noexcept { std::free(memory); }
+
+void operator delete(void* const memory, std::align_val_t) noexcept { std::free(memory); }
+
+void operator delete(void* const memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+
+namespace {
+
+void Run(std::string const& name, std::function<size_t()> const& build) {
+    long const allocations_before{num_allocations};
+    auto const start{std::chrono::steady_clock::now()};
+    size_t const num_knots{build()};
+    auto const end{std::chrono::steady_clock::now()};
+
+    std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(1) << std::setw(10)
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms " << std::setw(8)
+              << (num_allocations - allocations_before) << " allocations (" << num_knots << " knots)" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t const num_knots{(argc > 1) ? std::stoul(argv[1]) : 2'000'000};
+
+    std::vector<Eigen::Isometry3d> knots(num_knots, Eigen::Isometry3d::Identity());
+    for (size_t i{0}; i < num_knots; ++i) {
+        knots[i].translation() = Eigen::Vector3d{static_cast<double>(i), 0.0, 0.0};
+    }
+
+    Run("AddKnot() loop", [&]() {
+        Se3Spline spline{0, 1};
+        for (Eigen::Isometry3d const& knot : knots) {
+            spline.AddKnot(knot);
+        }
+        return spline.NumKnots();
+    });
+    Run("Reserve() + AddKnot() loop", [&]() {
+        Se3Spline spline{0, 1};
+        spline.Reserve(num_knots);
+        for (Eigen::Isometry3d const& knot : knots) {
+            spline.AddKnot(knot);
+        }
+        return spline.NumKnots();
+    });
+    Run("AddKnots() all at once", [&]() {
+        Se3Spline spline{0, 1};
+        spline.AddKnots(std::data(knots), std::size(knots));
+        return spline.NumKnots();
+    });
+    Run("AddKnots() in 1000 batches", [&]() {
+        Se3Spline spline{0, 1};
+        size_t const batch_size{num_knots / 1000};
+        for (size_t i{0}; i + batch_size <= num_knots; i += batch_size) {
+            spline.AddKnots(std::data(knots) + i, batch_size);
+        }
+        return spline.NumKnots();
+    });
+
+    // Many short lived splines, all kept alive until the end like they would be in an optimization problem
+    size_t const num_splines{100};
+    size_t const knots_per_spline{num_knots / num_splines};
+    Run("100 splines, default resource", [&]() {
+        std::vector<Se3Spline> splines;
+        splines.reserve(num_splines);
+        for (size_t i{0}; i < num_splines; ++i) {
+            splines.emplace_back(0, 1).AddKnots(std::data(knots), knots_per_spline);
+        }
+        return num_splines * knots_per_spline;
+    });
+    Run("100 splines, shared arena", [&]() {
+        // Sized for all knots including the geometric growth slack, so that the arena itself only allocates once
+        std::pmr::monotonic_buffer_resource arena{2 * num_knots * (sizeof(VectorD) + sizeof(Eigen::Matrix3d))};
+        std::vector<Se3Spline> splines;
+        splines.reserve(num_splines);
+        for (size_t i{0}; i < num_splines; ++i) {
+            splines.emplace_back(0, 1, &arena).AddKnots(std::data(knots), knots_per_spline);
+        }
+        return num_splines * knots_per_spline;
+    });
+
+    return EXIT_SUCCESS;
+}
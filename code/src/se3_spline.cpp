@@ -1,15 +1,74 @@
 #include "se3_spline.hpp"
 
+#include <algorithm>
+
+#include "segment_kernels.hpp"
+
 namespace reprojection_calibration::spline {
 
-Se3Spline::Se3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns)
-    : r3_spline_{t0_ns, delta_t_ns}, so3_spline_{t0_ns, delta_t_ns} {}
+namespace {
+
+// The pose and its derivatives up to the requested order from one segment setup, see internal::EvaluateSe3Segment().
+std::optional<internal::Se3Derivatives> EvaluateDerivatives(r3Spline const& r3_spline, So3Spline const& so3_spline,
+                                                            uint64_t const t_ns, DerivativeOrder const derivative) {
+    auto const normalized_position{r3_spline.Timing().SplinePosition(t_ns, std::size(r3_spline.knots_))};
+    if (not normalized_position.has_value()) {
+        return std::nullopt;
+    }
+    auto const [u_i, i]{normalized_position.value()};
+
+    auto const u{internal::TimeDerivatives(u_i, r3_spline.Timing().delta_t_ns_, derivative)};
+
+    return internal::EvaluateSe3Segment(internal::Se3Segment{r3_spline.knots_, so3_spline.knots_, i}, u, derivative);
+}
+
+}  // namespace
 
-void Se3Spline::AddKnot(Eigen::Isometry3d const knot) {
+Se3Spline::Se3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns, std::pmr::memory_resource* const resource)
+    : r3_spline_{t0_ns, delta_t_ns, resource}, so3_spline_{t0_ns, delta_t_ns, resource} {}
+
+void Se3Spline::Reserve(size_t const num_knots) {
+    r3_spline_.knots_.reserve(num_knots);
+    so3_spline_.knots_.reserve(num_knots);
+}
+
+void Se3Spline::AddKnot(Eigen::Isometry3d const& knot) {
     r3_spline_.knots_.push_back(knot.translation());
     so3_spline_.knots_.push_back(knot.linear());
 }
 
+void Se3Spline::AddKnots(Eigen::Isometry3d const* const knots, size_t const count) {
+    assert(knots != nullptr or count == 0);
+
+    Grow(count);
+    for (size_t i{0}; i < count; ++i) {
+        AddKnot(knots[i]);
+    }
+}
+
+void Se3Spline::AddKnots(Eigen::Ref<MatrixDX const> const& positions, Eigen::Matrix3d const* const rotations) {
+    size_t const count{static_cast<size_t>(positions.cols())};
+    assert(rotations != nullptr or count == 0);
+
+    Grow(count);
+    for (Eigen::Index i{0}; i < positions.cols(); ++i) {
+        r3_spline_.knots_.push_back(positions.col(i));
+    }
+    so3_spline_.knots_.insert(std::end(so3_spline_.knots_), rotations, rotations + count);
+}
+
+size_t Se3Spline::NumKnots() const { return std::size(r3_spline_.knots_); }
+
+// Reserving exactly the required size on every bulk append would make a loop of small appends quadratic, so we grow to
+// at least double the current capacity like push_back() does.
+void Se3Spline::Grow(size_t const num_new_knots) {
+    size_t const required{NumKnots() + num_new_knots};
+    size_t const capacity{r3_spline_.knots_.capacity()};
+    if (required > capacity) {
+        Reserve(std::max(required, 2 * capacity));
+    }
+}
+
 std::optional<Eigen::Isometry3d> Se3Spline::Evaluate(uint64_t const t_ns) const {
     // TODO(Jack): This is in essence repeating logic that we already have implemented elsewhere, is there anything
     // we can do to streamline this?
@@ -26,4 +85,98 @@ std::optional<Eigen::Isometry3d> Se3Spline::Evaluate(uint64_t const t_ns) const
     return result;
 }
 
+std::optional<Vector6d> Se3Spline::EvaluateVelocity(uint64_t const t_ns) const {
+    auto const result{EvaluateDerivatives(r3_spline_, so3_spline_, t_ns, DerivativeOrder::First)};
+    if (not result.has_value()) {
+        return std::nullopt;
+    }
+
+    Vector6d velocity;
+    velocity << result->omega, result->v;
+
+    return velocity;
+}
+
+std::optional<Vector6d> Se3Spline::EvaluateAcceleration(uint64_t const t_ns) const {
+    auto const result{EvaluateDerivatives(r3_spline_, so3_spline_, t_ns, DerivativeOrder::Second)};
+    if (not result.has_value()) {
+        return std::nullopt;
+    }
+
+    Vector6d acceleration;
+    acceleration << result->alpha, result->a;
+
+    return acceleration;
+}
+
+std::optional<std::tuple<Eigen::Isometry3d, Vector6d>> Se3Spline::EvaluateWithTimeOffset(uint64_t const t_ns,
+                                                                                         double const offset_ns) const {
+    auto const normalized_position{r3_spline_.Timing().SplinePosition(t_ns, offset_ns, NumKnots())};
+    if (not normalized_position.has_value()) {
+        return std::nullopt;
+    }
+    auto const [u_i, i]{normalized_position.value()};
+
+    // One segment setup for everything - the position and velocity share P * M, and the rotation and its derivative
+    // share the Exp() of each increment.
+    auto const u{internal::TimeDerivatives(u_i, r3_spline_.Timing().delta_t_ns_, DerivativeOrder::First)};
+    internal::Se3Derivatives const result{internal::EvaluateSe3Segment(
+        internal::Se3Segment{r3_spline_.knots_, so3_spline_.knots_, i}, u, DerivativeOrder::First)};
+
+    Eigen::Isometry3d pose{Eigen::Isometry3d::Identity()};
+    pose.linear() = result.R;
+    pose.translation() = result.p;
+
+    Vector6d twist;
+    twist << result.omega, result.v;
+
+    return std::tuple{pose, twist};
+}
+
+std::vector<std::optional<Eigen::Isometry3d>> Se3Spline::EvaluateRollingShutter(
+    uint64_t const t_start_ns, uint64_t const line_delay_ns, int const num_rows,
+    std::vector<std::optional<Vector6d>>* const twists) const {
+    assert(num_rows >= 0);
+
+    DerivativeOrder const derivative{(twists != nullptr) ? DerivativeOrder::First : DerivativeOrder::Null};
+    if (twists != nullptr) {
+        twists->assign(num_rows, std::nullopt);
+    }
+
+    std::vector<std::optional<Eigen::Isometry3d>> poses(num_rows);
+    internal::Se3Segment segment;
+    for (int r{0}; r < num_rows; ++r) {
+        auto const normalized_position{
+            r3_spline_.Timing().SplinePosition(t_start_ns + (r * line_delay_ns), NumKnots())};
+        if (not normalized_position.has_value()) {
+            continue;
+        }
+        auto const [u_i, i]{normalized_position.value()};
+
+        if (segment.rotation.i != i) {
+            segment = internal::Se3Segment{r3_spline_.knots_, so3_spline_.knots_, i};
+        }
+
+        auto const u{internal::TimeDerivatives(u_i, r3_spline_.Timing().delta_t_ns_, derivative)};
+        internal::Se3Derivatives const result{internal::EvaluateSe3Segment(segment, u, derivative)};
+
+        Eigen::Isometry3d pose{Eigen::Isometry3d::Identity()};
+        pose.linear() = result.R;
+        pose.translation() = result.p;
+        poses[r] = pose;
+
+        if (twists != nullptr) {
+            Vector6d twist;
+            twist << result.omega, result.v;
+            (*twists)[r] = twist;
+        }
+    }
+
+    return poses;
+}  // LCOV_EXCL_LINE
+
+r3Spline const& Se3Spline::PositionSpline() const { return r3_spline_; }
+
+So3Spline const& Se3Spline::RotationSpline() const { return so3_spline_; }
+
 }  // namespace reprojection_calibration::spline
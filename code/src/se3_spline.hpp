@@ -1,22 +1,74 @@
 #pragma once
 
 #include <Eigen/Geometry>
+#include <memory_resource>
 #include <optional>
+#include <tuple>
+#include <vector>
 
 #include "r3_spline.hpp"
 #include "so3_spline.hpp"
+#include "types.hpp"
 
 namespace reprojection_calibration::spline {
 
 class Se3Spline {
    public:
-    Se3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns);
+    // See r3Spline for the memory resource - both the position and rotation knots are allocated from it, and as there a
+    // copy of the spline allocates from the default resource instead.
+    Se3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns,
+              std::pmr::memory_resource* const resource = std::pmr::get_default_resource());
 
-    void AddKnot(Eigen::Isometry3d const knot);
+    // Reserves space for num_knots knots in total, so that the following AddKnot() calls do not reallocate.
+    void Reserve(size_t const num_knots);
+
+    void AddKnot(Eigen::Isometry3d const& knot);
+
+    // Appends many knots at once from contiguous caller owned memory (ex. a std::vector, a numpy array or any other raw
+    // buffer), without an intermediate copy. The knot storage grows at most once per call, geometrically, so that
+    // appending in a loop of small batches is still amortized linear. The second overload takes the positions (one per
+    // column) and the rotations (positions.cols() column major 3x3 matrices) as separate arrays, for callers that
+    // already store them that way.
+    void AddKnots(Eigen::Isometry3d const* const knots, size_t const count);
+
+    void AddKnots(Eigen::Ref<MatrixDX const> const& positions, Eigen::Matrix3d const* const rotations);
+
+    size_t NumKnots() const;
 
     std::optional<Eigen::Isometry3d> Evaluate(uint64_t const t_ns) const;
 
+    // First and second derivative of the pose as the twist [omega; v] with dR/dt = Hat(omega) * R and dp/dt = v, and
+    // its time derivative [alpha; a]. Both are the exact derivatives of Evaluate(), so the angular parts are NOT the
+    // same as So3Spline::EvaluateVelocity() and So3Spline::EvaluateAcceleration() (see
+    // So3Spline::EvaluateWithTimeDerivative()).
+    std::optional<Vector6d> EvaluateVelocity(uint64_t const t_ns) const;
+
+    std::optional<Vector6d> EvaluateAcceleration(uint64_t const t_ns) const;
+
+    // Evaluates the pose at the time t_ns + offset_ns, where the offset can be fractional and negative, together with
+    // its exact derivative with respect to time (which is the same as the derivative with respect to the offset). This
+    // is what a time offset calibration residual needs, without the two extra finite difference evaluations. The
+    // derivative is returned as the same twist as EvaluateVelocity().
+    std::optional<std::tuple<Eigen::Isometry3d, Vector6d>> EvaluateWithTimeOffset(uint64_t const t_ns,
+                                                                                  double const offset_ns) const;
+
+    // Evaluates the pose for each of the num_rows rows of a rolling shutter image, where row r is exposed at time
+    // t_start_ns + r * line_delay_ns. The rows are so tightly spaced that they almost always fall into one or two
+    // segments, so the segment setup is shared between rows. If twists is not null it is filled with the first
+    // derivative of each row pose as the twist [omega; v] (the same convention as EvaluateWithTimeOffset()) from the
+    // same evaluation.
+    std::vector<std::optional<Eigen::Isometry3d>> EvaluateRollingShutter(
+        uint64_t const t_start_ns, uint64_t const line_delay_ns, int const num_rows,
+        std::vector<std::optional<Vector6d>>* const twists = nullptr) const;
+
+    // Read only access to the two underlying splines, for algorithms that need to work on the knots directly.
+    r3Spline const& PositionSpline() const;
+
+    So3Spline const& RotationSpline() const;
+
    private:
+    void Grow(size_t const num_new_knots);
+
     r3Spline r3_spline_;
     So3Spline so3_spline_;
 };
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+
 #include "lie.hpp"
 #include "utilities_testing.hpp"
 
@@ -50,4 +52,183 @@ TEST(Se3Spline, TestSe3SplineEvaluate) {
     EXPECT_FLOAT_EQ(p_0->matrix().diagonal().sum(),
                     3.9593055);  // HEURISTIC! No theoretical testing strategy at this time - we have this here just so
     // that we can detect changes to the implementation quickly (hopefully. )
-}
\ No newline at end of file
+}
+
+TEST(Se3Spline, TestSe3SplineEvaluateRollingShutter) {
+    Se3Spline se3_spline{100, 50};
+
+    Eigen::Isometry3d knot_i{Eigen::Isometry3d::Identity()};
+    se3_spline.AddKnot(knot_i);
+    for (int i{1}; i < constants::k + 1; ++i) {
+        Eigen::Isometry3d delta{Eigen::Isometry3d::Identity()};
+        delta.rotate(Exp((static_cast<double>(i) / 10) * Eigen::Vector3d{1.0, -0.5 * i, 0.2 * i * i}));
+        delta.translation() = i * VectorD::Ones();
+
+        knot_i = delta * knot_i;
+        se3_spline.AddKnot(knot_i);
+    }
+
+    // 40 rows with a 3ns line delay starting halfway through the first segment - the frame spans both valid segments
+    // and the last rows fall off the end of the spline.
+    uint64_t const t_start_ns{125};
+    uint64_t const line_delay_ns{3};
+    int const num_rows{40};
+    std::vector<std::optional<Vector6d>> velocities;
+    auto const poses{se3_spline.EvaluateRollingShutter(t_start_ns, line_delay_ns, num_rows, &velocities)};
+    ASSERT_EQ(std::size(poses), num_rows);
+    ASSERT_EQ(std::size(velocities), num_rows);
+
+    for (int r{0}; r < num_rows; ++r) {
+        auto const pose{se3_spline.Evaluate(t_start_ns + r * line_delay_ns)};
+        ASSERT_EQ(poses[r].has_value(), pose.has_value());
+        ASSERT_EQ(velocities[r].has_value(), pose.has_value());
+
+        if (pose.has_value()) {
+            EXPECT_TRUE(poses[r]->isApprox(pose.value()));
+            auto const result{se3_spline.EvaluateWithTimeOffset(t_start_ns + r * line_delay_ns, 0.0)};
+            EXPECT_TRUE(velocities[r]->isApprox(std::get<1>(result.value())));
+        }
+    }
+    EXPECT_TRUE(poses[0].has_value());
+    EXPECT_FALSE(poses.back().has_value());
+
+    // Numerical derivative of the translation as a sanity check of the translational velocity
+    Eigen::Vector3d const numerical_v{(poses[2]->translation() - poses[0]->translation()) / (2 * line_delay_ns)};
+    EXPECT_TRUE(velocities[1]->bottomRows<3>().isApprox(numerical_v, 1e-3));
+
+    // And of the rotation, the increments do not share an axis so this only holds for the exact derivative
+    uint64_t const t_1_ns{t_start_ns + line_delay_ns};
+    Eigen::Matrix3d const R_plus{se3_spline.Evaluate(t_1_ns + 1)->linear()};
+    Eigen::Matrix3d const R_minus{se3_spline.Evaluate(t_1_ns - 1)->linear()};
+    Eigen::Vector3d const numerical_omega{Log(R_plus * R_minus.transpose()) / 2};
+    EXPECT_TRUE(velocities[1]->topRows<3>().isApprox(numerical_omega, 1e-3));
+}
+
+TEST(Se3Spline, TestSe3SplineEvaluateAcceleration) {
+    Se3Spline se3_spline{100, 50};
+    EXPECT_EQ(se3_spline.EvaluateAcceleration(100), std::nullopt);
+
+    for (int i{0}; i < constants::k; ++i) {
+        Eigen::Isometry3d knot{Eigen::Isometry3d::Identity()};
+        knot.rotate(Exp((static_cast<double>(i) / 10) * Eigen::Vector3d{1.0, -0.5 * i, 0.2 * i * i}));
+        knot.translation() = i * i * VectorD::Ones();
+        se3_spline.AddKnot(knot);
+    }
+
+    // Numerical derivative of the pose - the rotation axis changes between the knots, so the angular part only matches
+    // if it is the exact derivative of Evaluate().
+    auto const velocity{se3_spline.EvaluateVelocity(125)};
+    ASSERT_TRUE(velocity.has_value());
+    Eigen::Isometry3d const pose_plus{se3_spline.Evaluate(126).value()};
+    Eigen::Isometry3d const pose_minus{se3_spline.Evaluate(124).value()};
+    Vector6d numerical_v;
+    numerical_v << Log(pose_plus.linear() * pose_minus.linear().transpose()) / 2,
+        (pose_plus.translation() - pose_minus.translation()) / 2;
+    EXPECT_TRUE(velocity->isApprox(numerical_v, 1e-3));
+
+    // Numerical derivative of the velocity
+    auto const acceleration{se3_spline.EvaluateAcceleration(125)};
+    ASSERT_TRUE(acceleration.has_value());
+    Vector6d const numerical_a{(se3_spline.EvaluateVelocity(126).value() - se3_spline.EvaluateVelocity(124).value()) /
+                               2};
+    EXPECT_TRUE(acceleration->isApprox(numerical_a, 1e-3));
+}
+
+TEST(Se3Spline, TestSe3SplineEvaluateWithTimeOffset) {
+    Se3Spline se3_spline{100, 5};
+
+    Eigen::Isometry3d knot_i{Eigen::Isometry3d::Identity()};
+    se3_spline.AddKnot(knot_i);
+    for (int i{1}; i < constants::k + 1; ++i) {
+        Eigen::Isometry3d delta{Eigen::Isometry3d::Identity()};
+        delta.rotate(Exp((static_cast<double>(i) / 10) * Eigen::Vector3d{1.0, -1.0 * i, 0.5 * i * i}));
+        delta.translation() = i * i * VectorD::Ones();
+
+        knot_i = delta * knot_i;
+        se3_spline.AddKnot(knot_i);
+    }
+
+    auto const result_0{se3_spline.EvaluateWithTimeOffset(103, 0.0)};
+    ASSERT_TRUE(result_0.has_value());
+    EXPECT_TRUE(std::get<0>(result_0.value()).isApprox(se3_spline.Evaluate(103).value()));
+
+    // Compare the twist to a central finite difference over the offset
+    double const h{1e-4};
+    double const offset_ns{1.6};  // Crosses from the first into the second segment
+    auto const result{se3_spline.EvaluateWithTimeOffset(104, offset_ns)};
+    ASSERT_TRUE(result.has_value());
+    auto const [pose, twist]{result.value()};
+
+    Eigen::Isometry3d const pose_plus{std::get<0>(se3_spline.EvaluateWithTimeOffset(104, offset_ns + h).value())};
+    Eigen::Isometry3d const pose_minus{std::get<0>(se3_spline.EvaluateWithTimeOffset(104, offset_ns - h).value())};
+    Eigen::Vector3d const numerical_omega{Log(pose_plus.linear() * pose_minus.linear().transpose()) / (2 * h)};
+    Eigen::Vector3d const numerical_v{(pose_plus.translation() - pose_minus.translation()) / (2 * h)};
+
+    EXPECT_TRUE(twist.topRows<3>().isApprox(numerical_omega, 1e-6));
+    EXPECT_TRUE(twist.bottomRows<3>().isApprox(numerical_v, 1e-6));
+
+    EXPECT_EQ(se3_spline.EvaluateWithTimeOffset(104, 6.5), std::nullopt);  // Off the end of the spline
+}
+
+TEST(Se3Spline, TestSe3SplineAddKnots) {
+    std::vector<Eigen::Isometry3d> knots;
+    for (int i{0}; i < 10; ++i) {
+        Eigen::Isometry3d knot{Eigen::Isometry3d::Identity()};
+        knot.rotate(Exp((static_cast<double>(i) / 10) * Eigen::Vector3d{1.0, -0.5, 0.2 * i}));
+        knot.translation() = i * i * VectorD::Ones();
+        knots.push_back(knot);
+    }
+
+    Se3Spline one_by_one{100, 5};
+    for (auto const& knot : knots) {
+        one_by_one.AddKnot(knot);
+    }
+
+    // All at once and in two batches from separate position and rotation arrays
+    Se3Spline bulk{100, 5};
+    bulk.AddKnots(std::data(knots), std::size(knots));
+
+    MatrixDX positions(constants::d, std::size(knots));
+    std::vector<Eigen::Matrix3d> rotations;
+    for (size_t i{0}; i < std::size(knots); ++i) {
+        positions.col(i) = knots[i].translation();
+        rotations.push_back(knots[i].linear());
+    }
+    Se3Spline split{100, 5};
+    split.AddKnots(positions.leftCols(4), std::data(rotations));
+    split.AddKnots(positions.rightCols(6), std::data(rotations) + 4);
+
+    ASSERT_EQ(bulk.NumKnots(), std::size(knots));
+    ASSERT_EQ(split.NumKnots(), std::size(knots));
+    for (uint64_t t_ns{100}; t_ns < 135; t_ns += 2) {
+        auto const pose{one_by_one.Evaluate(t_ns)};
+        ASSERT_TRUE(pose.has_value());
+        EXPECT_TRUE(bulk.Evaluate(t_ns)->isApprox(pose.value()));
+        EXPECT_TRUE(split.Evaluate(t_ns)->isApprox(pose.value()));
+    }
+}
+
+TEST(Se3Spline, TestSe3SplineMemoryResource) {
+    // All knots come from the buffer - the upstream null resource throws if anything has to be allocated elsewhere
+    alignas(64) std::array<std::byte, 8192> buffer;
+    std::pmr::monotonic_buffer_resource arena{std::data(buffer), std::size(buffer), std::pmr::null_memory_resource()};
+
+    Se3Spline se3_spline{100, 5, &arena};
+    se3_spline.Reserve(20);
+    for (int i{0}; i < 20; ++i) {
+        se3_spline.AddKnot(Eigen::Isometry3d::Identity());
+    }
+    EXPECT_TRUE(se3_spline.Evaluate(150).value().isApprox(Eigen::Isometry3d::Identity()));
+
+    auto const* const buffer_begin{std::data(buffer)};
+    auto const* const buffer_end{buffer_begin + std::size(buffer)};
+    auto const* const positions{reinterpret_cast<std::byte const*>(se3_spline.PositionSpline().knots_.data())};
+    auto const* const rotations{reinterpret_cast<std::byte const*>(se3_spline.RotationSpline().knots_.data())};
+    EXPECT_TRUE(buffer_begin <= positions and positions < buffer_end);
+    EXPECT_TRUE(buffer_begin <= rotations and rotations < buffer_end);
+
+    // A copy does not keep the arena
+    Se3Spline const copy{se3_spline};
+    EXPECT_EQ(copy.PositionSpline().knots_.get_allocator().resource(), std::pmr::get_default_resource());
+    EXPECT_TRUE(copy.Evaluate(150).value().isApprox(Eigen::Isometry3d::Identity()));
+}
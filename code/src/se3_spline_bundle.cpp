@@ -0,0 +1,140 @@
+#include "se3_spline_bundle.hpp"
+
+#include "constants.hpp"
+#include "lie.hpp"
+#include "r3_spline.hpp"
+#include "types.hpp"
+#include "utilities.hpp"
+
+namespace reprojection_calibration::spline {
+
+namespace {
+
+// Exp() for N so(3) vectors at once - phi is N x 3 and the result is N x 9 with the column-major rotation matrix
+// entries. Uses the form R = cos(angle) * I + (sin(angle)/angle) * Hat(phi) + ((1 - cos(angle))/angle^2) * phi * phi^T
+// which does not need the axis, and like Exp() falls back to the first order taylor expansion for small angles.
+Eigen::ArrayXXd ExpBundle(Eigen::ArrayXXd const& phi) {
+    Eigen::ArrayXd const angle{phi.square().rowwise().sum().sqrt()};
+    Eigen::Array<bool, Eigen::Dynamic, 1> const small{angle < 1e-6};
+
+    Eigen::ArrayXd const cos{small.select(1.0, angle.cos())};
+    Eigen::ArrayXd const a{small.select(1.0, angle.sin() / angle)};
+    Eigen::ArrayXd const b{small.select(0.0, (1.0 - cos) / angle.square())};
+
+    Eigen::ArrayXXd R(phi.rows(), 9);
+    for (int c{0}; c < 3; ++c) {
+        for (int r{0}; r < 3; ++r) {
+            R.col(r + 3 * c) = b * phi.col(r) * phi.col(c);
+        }
+        R.col(c + 3 * c) += cos;
+    }
+    R.col(1) += a * phi.col(2);  // Hat(phi) entries - (1, 0)
+    R.col(2) -= a * phi.col(1);  // (2, 0)
+    R.col(3) -= a * phi.col(2);  // (0, 1)
+    R.col(5) += a * phi.col(0);  // (2, 1)
+    R.col(6) += a * phi.col(1);  // (0, 2)
+    R.col(7) -= a * phi.col(0);  // (1, 2)
+
+    return R;
+}
+
+// Matrix product A * B for N pairs of 3x3 matrices stored as N x 9 column-major entries.
+Eigen::ArrayXXd MultiplyBundle(Eigen::ArrayXXd const& A, Eigen::ArrayXXd const& B) {
+    Eigen::ArrayXXd C{Eigen::ArrayXXd::Zero(A.rows(), 9)};
+    for (int c{0}; c < 3; ++c) {
+        for (int r{0}; r < 3; ++r) {
+            for (int m{0}; m < 3; ++m) {
+                C.col(r + 3 * c) += A.col(r + 3 * m) * B.col(m + 3 * c);
+            }
+        }
+    }
+
+    return C;
+}  // LCOV_EXCL_LINE
+
+}  // namespace
+
+Se3SplineBundle::Se3SplineBundle(uint64_t const t0_ns, uint64_t const delta_t_ns, int const num_trajectories)
+    : time_handler_{t0_ns, delta_t_ns, constants::k}, num_trajectories_{num_trajectories} {
+    assert(num_trajectories > 0);
+}
+
+void Se3SplineBundle::AddKnots(std::vector<Eigen::Isometry3d> const& knots) {
+    assert(std::size(knots) == static_cast<size_t>(num_trajectories_));
+
+    int const N{num_trajectories_};
+    int const knot{static_cast<int>(NumKnots())};
+    positions_.resize(positions_.size() + 3 * N);
+    rotations_.resize(rotations_.size() + 9 * N);
+
+    Eigen::Map<Eigen::ArrayXXd> positions(positions_.data() + knot * 3 * N, N, 3);
+    Eigen::Map<Eigen::ArrayXXd> rotations(rotations_.data() + knot * 9 * N, N, 9);
+    for (int n{0}; n < N; ++n) {
+        Eigen::Matrix3d const R{knots[n].linear()};  // Copy because linear() is a block with the stride of a 4x4 matrix
+        positions.row(n) = knots[n].translation().transpose().array();
+        rotations.row(n) = Eigen::Map<Eigen::Array<double, 1, 9> const>(R.data());
+    }
+
+    if (knot == 0) {
+        return;
+    }
+
+    delta_phis_.resize(delta_phis_.size() + 3 * N);
+    Eigen::Map<Eigen::ArrayXXd> delta_phis(delta_phis_.data() + (knot - 1) * 3 * N, N, 3);
+    Eigen::Map<Eigen::ArrayXXd const> const previous_rotations{Rotations(knot - 1)};
+    for (int n{0}; n < N; ++n) {
+        Eigen::Matrix3d const R_0{Eigen::Map<Eigen::Matrix3d const>(previous_rotations.row(n).eval().data())};
+        delta_phis.row(n) = Log(R_0.inverse() * knots[n].linear()).transpose().array();
+    }
+}
+
+std::optional<std::vector<Eigen::Isometry3d>> Se3SplineBundle::Evaluate(uint64_t const t_ns) const {
+    auto const normalized_position{time_handler_.SplinePosition(t_ns, NumKnots())};
+    if (not normalized_position.has_value()) {
+        return std::nullopt;
+    }
+    auto const [u_i, i]{normalized_position.value()};
+
+    // Shared between all trajectories - this is the work that N independent Se3Spline::Evaluate() calls repeat N times
+    static MatrixKK const M{BlendingMatrix(constants::k)};
+    static MatrixKK const M_cumulative{CumulativeBlendingMatrix(constants::k)};
+    VectorK const u{r3Spline::CalculateU(u_i, DerivativeOrder::Null)};
+    VectorK const weight_r3{M * u};
+    VectorK const weight_so3{M_cumulative * u};
+
+    Eigen::ArrayXXd position{weight_r3[0] * Positions(i)};
+    for (int j{1}; j < constants::k; ++j) {
+        position += weight_r3[j] * Positions(i + j);
+    }
+
+    Eigen::ArrayXXd rotation{Rotations(i)};
+    for (int j{0}; j < (constants::k - 1); ++j) {
+        rotation = MultiplyBundle(ExpBundle(weight_so3[j + 1] * DeltaPhis(i + j)), rotation);
+    }
+
+    std::vector<Eigen::Isometry3d> poses(num_trajectories_, Eigen::Isometry3d::Identity());
+    for (int n{0}; n < num_trajectories_; ++n) {
+        poses[n].linear() = Eigen::Map<Eigen::Matrix3d const>(rotation.row(n).eval().data());
+        poses[n].translation() = position.row(n).transpose().matrix();
+    }
+
+    return poses;
+}
+
+int Se3SplineBundle::NumTrajectories() const { return num_trajectories_; }
+
+size_t Se3SplineBundle::NumKnots() const { return std::size(positions_) / (3 * num_trajectories_); }
+
+Eigen::Map<Eigen::ArrayXXd const> Se3SplineBundle::Positions(int const knot) const {
+    return Eigen::Map<Eigen::ArrayXXd const>(positions_.data() + knot * 3 * num_trajectories_, num_trajectories_, 3);
+}
+
+Eigen::Map<Eigen::ArrayXXd const> Se3SplineBundle::Rotations(int const knot) const {
+    return Eigen::Map<Eigen::ArrayXXd const>(rotations_.data() + knot * 9 * num_trajectories_, num_trajectories_, 9);
+}
+
+Eigen::Map<Eigen::ArrayXXd const> Se3SplineBundle::DeltaPhis(int const knot) const {
+    return Eigen::Map<Eigen::ArrayXXd const>(delta_phis_.data() + knot * 3 * num_trajectories_, num_trajectories_, 3);
+}
+
+}  // namespace reprojection_calibration::spline
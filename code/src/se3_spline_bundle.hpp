@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Eigen/Geometry>
+#include <optional>
+#include <vector>
+
+#include "utilities.hpp"
+
+namespace reprojection_calibration::spline {
+
+// Many Se3Spline trajectories that share the same t0_ns and delta_t_ns (ex. all sensors of a multi-sensor rig) and are
+// therefore always evaluated at the same timestamps. Instead of N independent splines each with their own knot
+// vectors, the knots of all trajectories are stored interleaved as a structure of arrays - for each knot and each
+// component (x, y, z or rotation matrix entry) there is one contiguous array with the value for all N trajectories.
+// This means that the time lookup and blending weights are calculated once per timestamp and the rest of the
+// evaluation is a vectorized sweep over the N trajectories.
+//
+// The evaluated values are the same as those from Se3Spline::Evaluate() for each trajectory individually.
+class Se3SplineBundle {
+   public:
+    Se3SplineBundle(uint64_t const t0_ns, uint64_t const delta_t_ns, int const num_trajectories);
+
+    // Appends one knot to every trajectory - knots[n] is the new knot of trajectory n.
+    void AddKnots(std::vector<Eigen::Isometry3d> const& knots);
+
+    std::optional<std::vector<Eigen::Isometry3d>> Evaluate(uint64_t const t_ns) const;
+
+    int NumTrajectories() const;
+
+    size_t NumKnots() const;
+
+   private:
+    // Views of the N x 3 (or N x 9 for rotations) block that belongs to one knot, where each column is the contiguous
+    // array of one component for all trajectories.
+    Eigen::Map<Eigen::ArrayXXd const> Positions(int const knot) const;
+
+    Eigen::Map<Eigen::ArrayXXd const> Rotations(int const knot) const;
+
+    Eigen::Map<Eigen::ArrayXXd const> DeltaPhis(int const knot) const;
+
+    TimeHandler time_handler_;
+    int num_trajectories_;
+    std::vector<double> positions_;
+    std::vector<double> rotations_;  // Column-major rotation matrix entries, same as Eigen::Matrix3d
+    // The so(3) increments Log(R_i^-1 * R_i+1) between consecutive knots only depend on the knots, so we calculate them
+    // once when the knots are added instead of on every evaluation.
+    std::vector<double> delta_phis_;
+};
+
+}  // namespace reprojection_calibration::spline
@@ -0,0 +1,62 @@
+#include "se3_spline_bundle.hpp"
+
+#include <gtest/gtest.h>
+
+#include "constants.hpp"
+#include "lie.hpp"
+#include "se3_spline.hpp"
+
+using namespace reprojection_calibration::spline;
+
+TEST(Se3SplineBundle, TestSe3SplineBundleInvalidEvaluateConditions) {
+    Se3SplineBundle bundle{100, 5, 3};
+    EXPECT_EQ(bundle.NumTrajectories(), 3);
+    EXPECT_EQ(bundle.Evaluate(115), std::nullopt);
+
+    for (int i{0}; i < constants::k; ++i) {
+        bundle.AddKnots(std::vector<Eigen::Isometry3d>(3, Eigen::Isometry3d::Identity()));
+    }
+    EXPECT_EQ(bundle.NumKnots(), constants::k);
+
+    auto const poses{bundle.Evaluate(100)};
+    ASSERT_TRUE(poses.has_value());
+    EXPECT_EQ(std::size(poses.value()), 3);
+    EXPECT_EQ(bundle.Evaluate(105), std::nullopt);
+
+    bundle.AddKnots(std::vector<Eigen::Isometry3d>(3, Eigen::Isometry3d::Identity()));
+    EXPECT_NE(bundle.Evaluate(105), std::nullopt);
+}
+
+TEST(Se3SplineBundle, TestSe3SplineBundleEvaluate) {
+    int const num_trajectories{5};
+    int const num_knots{8};
+    uint64_t const delta_t_ns{5};
+
+    Se3SplineBundle bundle{100, delta_t_ns, num_trajectories};
+    std::vector<Se3Spline> se3_splines(num_trajectories, Se3Spline{100, delta_t_ns});
+
+    std::vector<Eigen::Isometry3d> knots(num_trajectories, Eigen::Isometry3d::Identity());
+    for (int i{0}; i < num_knots; ++i) {
+        for (int n{0}; n < num_trajectories; ++n) {
+            // Every trajectory gets a different rate so that they are not just copies of each other
+            Eigen::Isometry3d delta{Eigen::Isometry3d::Identity()};
+            delta.rotate(Exp((static_cast<double>(i + n) / 10) * Eigen::Vector3d{1, -1, 2}));
+            delta.translation() = (n + 1) * i * VectorD::Ones();
+            knots[n] = delta * knots[n];
+
+            se3_splines[n].AddKnot(knots[n]);
+        }
+        bundle.AddKnots(knots);
+    }
+
+    for (uint64_t t_ns{100}; t_ns < 100 + (num_knots - constants::k + 1) * delta_t_ns; ++t_ns) {
+        auto const poses{bundle.Evaluate(t_ns)};
+        ASSERT_TRUE(poses.has_value());
+
+        for (int n{0}; n < num_trajectories; ++n) {
+            auto const pose_n{se3_splines[n].Evaluate(t_ns)};
+            ASSERT_TRUE(pose_n.has_value());
+            EXPECT_TRUE(poses.value()[n].isApprox(pose_n.value()));
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "lie.hpp"
+#include "se3_spline_sampler.hpp"
+
+using namespace reprojection_calibration::spline;
+
+// Peak memory and throughput of streaming a long trajectory with Se3SplineSampler versus materializing every sample
+// in a std::vector first. The peak resident set size is a per process high water mark, so each mode has to run in its
+// own process:
+//
+//      se3_spline_sampler.benchmark <seconds> sampler
+//      se3_spline_sampler.benchmark <seconds> vector
+//
+// The trajectory has knots at 100 Hz and is sampled at 1 kHz. With the sampler the peak memory should stay at the size
+// of the knots no matter how long the trajectory is, while for the vector it grows linearly with the duration.
+
+namespace {
+
+long PeakRssKb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss;  // Kilobytes on Linux
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <seconds> <sampler|vector>" << std::endl;
+        return EXIT_FAILURE;
+    }
+    uint64_t const seconds{std::stoull(argv[1])};
+    std::string const mode{argv[2]};
+
+    uint64_t const delta_t_ns{10'000'000};
+    Se3Spline spline{0, delta_t_ns};
+    spline.Reserve(seconds * 100 + constants::k);
+    for (uint64_t i{0}; i < seconds * 100 + constants::k; ++i) {
+        Eigen::Isometry3d knot{Eigen::Isometry3d::Identity()};
+        knot.rotate(Exp(0.01 * i * Eigen::Vector3d{1.0, 0.5, -0.25}.normalized()));
+        knot.translation() = Eigen::Vector3d{0.1 * i, std::sin(0.01 * i), 0.0};
+        spline.AddKnot(knot);
+    }
+    long const knots_rss_kb{PeakRssKb()};
+
+    uint64_t const step_ns{1'000'000};
+    uint64_t const end_ns{seconds * 1'000'000'000};
+    double checksum{0};  // Consumes the samples so that nothing is optimized away
+    uint64_t num_samples{0};
+
+    auto const start{std::chrono::steady_clock::now()};
+    if (mode == "sampler") {
+        Se3SplineSampler sampler{spline, 0, end_ns, step_ns, 4096, DerivativeOrder::First};
+        while (not sampler.Done()) {
+            for (Se3Sample const& sample : sampler.NextChunk()) {
+                checksum += sample.pose.translation().x() + sample.velocity[0];
+                ++num_samples;
+            }
+        }
+    } else if (mode == "vector") {
+        std::vector<Se3Sample> samples;
+        for (uint64_t t_ns{0}; t_ns < end_ns; t_ns += step_ns) {
+            auto const pose{spline.Evaluate(t_ns)};
+            auto const velocity{spline.EvaluateVelocity(t_ns)};
+            if (pose.has_value() and velocity.has_value()) {
+                samples.push_back(Se3Sample{t_ns, pose.value(), velocity.value(), Vector6d::Zero()});
+            }
+        }
+        for (Se3Sample const& sample : samples) {
+            checksum += sample.pose.translation().x() + sample.velocity[0];
+            ++num_samples;
+        }
+    } else {
+        std::cerr << "Unknown mode: " << mode << std::endl;
+        return EXIT_FAILURE;
+    }
+    auto const end{std::chrono::steady_clock::now()};
+
+    std::cout << mode << " " << seconds << "s - samples: " << num_samples << " peak rss: " << PeakRssKb()
+              << " KB (knots only: " << knots_rss_kb << " KB) ns/sample: "
+              << std::chrono::duration<double, std::nano>(end - start).count() / num_samples
+              << " checksum: " << checksum << std::endl;
+
+    return EXIT_SUCCESS;
+}
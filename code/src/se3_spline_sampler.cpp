@@ -0,0 +1,89 @@
+#include "se3_spline_sampler.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "constants.hpp"
+
+namespace reprojection_calibration::spline {
+
+namespace {
+
+// Number of grid points t_start_ns + n * step_ns in [t_start_ns, t_end_ns), written so that nothing can overflow.
+uint64_t GridCount(uint64_t const t_start_ns, uint64_t const t_end_ns, uint64_t const step_ns) {
+    return (t_end_ns > t_start_ns) ? ((t_end_ns - t_start_ns - 1) / step_ns) + 1 : 0;
+}
+
+// End (exclusive) of the valid time range [t0_ns, t0_ns + num_segments * delta_t_ns), saturated instead of wrapping.
+uint64_t ValidEnd(TimeHandler const& timing, size_t const num_knots) {
+    if (num_knots < constants::k) {
+        return timing.t0_ns_;
+    }
+    uint64_t const num_segments{num_knots - constants::k + 1};
+
+    uint64_t const max_ns{std::numeric_limits<uint64_t>::max()};
+    if (num_segments > (max_ns - timing.t0_ns_) / timing.delta_t_ns_) {
+        return max_ns;
+    }
+
+    return timing.t0_ns_ + (num_segments * timing.delta_t_ns_);
+}
+
+}  // namespace
+
+Se3SplineSampler::Se3SplineSampler(Se3Spline const& spline, uint64_t const t_start_ns, uint64_t const t_end_ns,
+                                   uint64_t const step_ns, int const chunk_size, DerivativeOrder const derivative)
+    : spline_{spline},
+      t_start_ns_{t_start_ns},
+      step_ns_{step_ns},
+      next_sample_{0},
+      end_sample_{0},
+      chunk_size_{chunk_size},
+      derivative_{derivative} {
+    assert(step_ns > 0);
+    assert(chunk_size > 0);
+    assert(derivative <= DerivativeOrder::Second);
+
+    // Skip the grid points before the first valid time and stop at the last valid time
+    TimeHandler const& timing{spline.PositionSpline().Timing()};
+    next_sample_ = GridCount(t_start_ns, timing.t0_ns_, step_ns);
+    end_sample_ = std::max(next_sample_,
+                           GridCount(t_start_ns, std::min(t_end_ns, ValidEnd(timing, spline.NumKnots())), step_ns));
+
+    chunk_.reserve(chunk_size);
+}
+
+std::vector<Se3Sample> const& Se3SplineSampler::NextChunk() {
+    chunk_.clear();
+
+    TimeHandler const& timing{spline_.PositionSpline().Timing()};
+    uint64_t const num_rows{std::min<uint64_t>(chunk_size_, end_sample_ - next_sample_)};
+    for (uint64_t r{0}; r < num_rows; ++r, ++next_sample_) {
+        uint64_t const t_ns{t_start_ns_ + (next_sample_ * step_ns_)};
+
+        // Always valid because the grid was clamped to the valid time range
+        auto const normalized_position{timing.SplinePosition(t_ns, spline_.NumKnots())};
+        assert(normalized_position.has_value());
+        auto const [u_i, i]{normalized_position.value()};
+
+        if (segment_.rotation.i != i) {
+            segment_ = internal::Se3Segment{spline_.PositionSpline().knots_, spline_.RotationSpline().knots_, i};
+        }
+
+        auto const u{internal::TimeDerivatives(u_i, timing.delta_t_ns_, derivative_)};
+        internal::Se3Derivatives const result{internal::EvaluateSe3Segment(segment_, u, derivative_)};
+
+        Se3Sample sample{t_ns, Eigen::Isometry3d::Identity(), Vector6d::Zero(), Vector6d::Zero()};
+        sample.pose.linear() = result.R;
+        sample.pose.translation() = result.p;
+        sample.velocity << result.omega, result.v;
+        sample.acceleration << result.alpha, result.a;
+        chunk_.push_back(sample);
+    }
+
+    return chunk_;
+}
+
+bool Se3SplineSampler::Done() const { return next_sample_ >= end_sample_; }
+
+}  // namespace reprojection_calibration::spline
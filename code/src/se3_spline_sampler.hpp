@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Eigen/Geometry>
+#include <vector>
+
+#include "se3_spline.hpp"
+#include "segment_kernels.hpp"
+#include "types.hpp"
+
+namespace reprojection_calibration::spline {
+
+struct Se3Sample {
+    uint64_t t_ns;
+    Eigen::Isometry3d pose;
+    Vector6d velocity;      // Only filled if requested, see Se3Spline::EvaluateVelocity()
+    Vector6d acceleration;  // Only filled if requested, see Se3Spline::EvaluateAcceleration()
+};
+
+// Lazy, pull based sampler of a Se3Spline on the regular time grid t_start_ns, t_start_ns + step_ns, ... < t_end_ns,
+// for streaming densely sampled trajectories to disk or over the network without materializing all samples up front.
+// Each call to NextChunk() evaluates and returns the next chunk_size samples, so the consumer sets the pace (i.e. a
+// slow writer simply calls less often) and the memory use is one chunk no matter how long the trajectory is.
+//
+// The grid is clamped to the valid time range of the spline at construction, so grid times before its first or after
+// its last valid segment are never visited and every call evaluates at most chunk_size samples. Consecutive samples
+// that fall into the same segment share its setup (see internal::Se3Segment), also for the derivatives, which are the
+// same as Se3Spline::EvaluateVelocity() and Se3Spline::EvaluateAcceleration().
+//
+// Usage:
+//      Se3SplineSampler sampler{spline, t_start_ns, t_end_ns, step_ns, 1024};
+//      while (not sampler.Done()) {
+//          for (Se3Sample const& sample : sampler.NextChunk()) { ... }
+//      }
+//
+// WARN(Jack): The sampler keeps a reference to the spline, so the spline has to outlive it and must not have its
+// knots edited while sampling.
+class Se3SplineSampler {
+   public:
+    Se3SplineSampler(Se3Spline const& spline, uint64_t const t_start_ns, uint64_t const t_end_ns,
+                     uint64_t const step_ns, int const chunk_size,
+                     DerivativeOrder const derivative = DerivativeOrder::Null);
+
+    // Returns the next (at most chunk_size) samples, or an empty chunk once Done(). The returned chunk is only valid
+    // until the next call, its storage is reused.
+    std::vector<Se3Sample> const& NextChunk();
+
+    bool Done() const;
+
+   private:
+    Se3Spline const& spline_;
+    uint64_t t_start_ns_;
+    uint64_t step_ns_;
+    uint64_t next_sample_;  // Grid index, the sample time is t_start_ns_ + n * step_ns_
+    uint64_t end_sample_;   // Exclusive
+    int chunk_size_;
+    DerivativeOrder derivative_;
+    internal::Se3Segment segment_;  // Setup of the segment of the last sample, reused across chunks
+    std::vector<Se3Sample> chunk_;
+};
+
+}  // namespace reprojection_calibration::spline
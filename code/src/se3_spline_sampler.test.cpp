@@ -0,0 +1,136 @@
+#include "se3_spline_sampler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "constants.hpp"
+#include "lie.hpp"
+
+using namespace reprojection_calibration::spline;
+
+Se3Spline SamplerTestSpline() {
+    Se3Spline spline{100, 50};
+    for (int i{0}; i < 6; ++i) {
+        Eigen::Isometry3d knot{Eigen::Isometry3d::Identity()};
+        knot.rotate(Exp((static_cast<double>(i) / 10) * Eigen::Vector3d{1.0, -0.5, 0.2 * i}));
+        knot.translation() = i * i * VectorD::Ones();
+        spline.AddKnot(knot);
+    }
+
+    return spline;  // Valid time range is [100, 250)
+}
+
+TEST(Se3SplineSampler, TestSe3SplineSamplerMatchesEvaluate) {
+    Se3Spline const spline{SamplerTestSpline()};
+
+    // Starts before and ends after the valid range, so samples on both ends are skipped
+    int const chunk_size{7};
+    Se3SplineSampler sampler{spline, 90, 300, 3, chunk_size, DerivativeOrder::Second};
+
+    std::vector<uint64_t> sampled_t_ns;
+    Se3Sample const* chunk_storage{nullptr};
+    while (not sampler.Done()) {
+        auto const& chunk{sampler.NextChunk()};
+        EXPECT_LE(std::size(chunk), chunk_size);
+        ASSERT_FALSE(chunk.empty());  // The invalid times on both ends are clamped away, not returned as empty chunks
+
+        // The chunk storage is reused, i.e. memory does not grow with the number of samples
+        if (chunk_storage != nullptr) {
+            EXPECT_EQ(chunk.data(), chunk_storage);
+        }
+        chunk_storage = chunk.data();
+
+        for (Se3Sample const& sample : chunk) {
+            sampled_t_ns.push_back(sample.t_ns);
+            EXPECT_TRUE(sample.pose.isApprox(spline.Evaluate(sample.t_ns).value()));
+            EXPECT_TRUE(sample.velocity.isApprox(spline.EvaluateVelocity(sample.t_ns).value()));
+            EXPECT_TRUE(sample.acceleration.isApprox(spline.EvaluateAcceleration(sample.t_ns).value()));
+        }
+    }
+    EXPECT_TRUE(sampler.NextChunk().empty());
+
+    // Every valid grid time exactly once and in order, 102 is the first and 249 the last valid one on the grid
+    ASSERT_EQ(std::size(sampled_t_ns), 50);
+    for (size_t n{0}; n < std::size(sampled_t_ns); ++n) {
+        EXPECT_EQ(sampled_t_ns[n], 102 + 3 * n);
+    }
+}
+
+TEST(Se3SplineSampler, TestSe3SplineSamplerNoDerivatives) {
+    Se3Spline const spline{SamplerTestSpline()};
+
+    Se3SplineSampler sampler{spline, 100, 110, 5, 100};
+    auto const& chunk{sampler.NextChunk()};
+    ASSERT_EQ(std::size(chunk), 2);  // The end time is not included
+    EXPECT_TRUE(chunk[1].velocity.isZero());
+    EXPECT_TRUE(sampler.Done());
+}
+
+TEST(Se3SplineSampler, TestSe3SplineSamplerEmpty) {
+    Se3Spline const spline{SamplerTestSpline()};
+
+    Se3SplineSampler empty_interval{spline, 200, 200, 1, 10};
+    EXPECT_TRUE(empty_interval.Done());
+    EXPECT_TRUE(empty_interval.NextChunk().empty());
+
+    // Entirely outside of the valid time range [100, 250)
+    Se3SplineSampler invalid_interval{spline, 250, 400, 1, 10};
+    EXPECT_TRUE(invalid_interval.Done());
+    EXPECT_TRUE(invalid_interval.NextChunk().empty());
+
+    Se3SplineSampler before_start{spline, 0, 100, 1, 10};
+    EXPECT_TRUE(before_start.Done());
+
+    // Splines without a single valid segment
+    Se3Spline short_spline{100, 50};
+    Se3SplineSampler no_knots{short_spline, 0, 1000, 1, 10};
+    EXPECT_TRUE(no_knots.Done());
+    EXPECT_TRUE(no_knots.NextChunk().empty());
+
+    for (int i{0}; i < constants::k - 1; ++i) {
+        short_spline.AddKnot(Eigen::Isometry3d::Identity());
+    }
+    Se3SplineSampler too_few_knots{short_spline, 0, 1000, 1, 10};
+    EXPECT_TRUE(too_few_knots.Done());
+}
+
+TEST(Se3SplineSampler, TestSe3SplineSamplerNoOverflow) {
+    Se3Spline const spline{SamplerTestSpline()};
+    uint64_t const max_ns{std::numeric_limits<uint64_t>::max()};
+
+    // Only the very first grid time 120 is valid, the next one would be far past the end
+    Se3SplineSampler huge_step{spline, 120, max_ns, max_ns - 1, 10};
+    auto const& chunk{huge_step.NextChunk()};
+    ASSERT_EQ(std::size(chunk), 1);
+    EXPECT_EQ(chunk[0].t_ns, 120);
+    EXPECT_TRUE(huge_step.Done());
+
+    // The grid times 0 and max_ns - 1 are both invalid
+    Se3SplineSampler huge_interval{spline, 0, max_ns, max_ns - 1, 10};
+    EXPECT_TRUE(huge_interval.Done());
+}
+
+TEST(Se3SplineSampler, TestSe3SplineSamplerSaturatedEnd) {
+    // The valid time range [t0, t0 + 3 * 500) of this spline ends past the largest representable time, so sampling
+    // has to stop exactly at max_ns - 1 instead of wrapping around
+    uint64_t const max_ns{std::numeric_limits<uint64_t>::max()};
+    Se3Spline spline{max_ns - 1000, 500};
+    for (int i{0}; i < 6; ++i) {
+        Eigen::Isometry3d knot{Eigen::Isometry3d::Identity()};
+        knot.translation() = i * VectorD::Ones();
+        spline.AddKnot(knot);
+    }
+
+    Se3SplineSampler sampler{spline, max_ns - 10, max_ns, 1, 4};
+    std::vector<uint64_t> sampled_t_ns;
+    while (not sampler.Done()) {
+        for (Se3Sample const& sample : sampler.NextChunk()) {
+            sampled_t_ns.push_back(sample.t_ns);
+            EXPECT_TRUE(sample.pose.isApprox(spline.Evaluate(sample.t_ns).value()));
+        }
+    }
+    ASSERT_EQ(std::size(sampled_t_ns), 10);
+    EXPECT_EQ(sampled_t_ns.front(), max_ns - 10);
+    EXPECT_EQ(sampled_t_ns.back(), max_ns - 1);
+}
@@ -0,0 +1,82 @@
+#include "segment_kernels.hpp"
+
+#include <cmath>
+
+#include "r3_spline.hpp"
+#include "utilities.hpp"
+
+namespace reprojection_calibration::spline::internal {
+
+std::array<VectorK, 3> TimeDerivatives(double const u_i, uint64_t const delta_t_ns, DerivativeOrder const derivative) {
+    assert(derivative <= DerivativeOrder::Second);
+
+    std::array<VectorK, 3> u{VectorK::Zero(), VectorK::Zero(), VectorK::Zero()};
+    for (int n{0}; n <= static_cast<int>(derivative); ++n) {
+        u[n] = r3Spline::CalculateU(u_i, static_cast<DerivativeOrder>(n)) / std::pow(delta_t_ns, n);
+    }
+
+    return u;
+}
+
+std::array<Eigen::Vector3d, constants::k - 1> DeltaPhis(std::pmr::vector<Eigen::Matrix3d> const& knots,
+                                                        int const segment) {
+    std::array<Eigen::Vector3d, constants::k - 1> delta_phis;
+    for (int j{0}; j < (constants::k - 1); ++j) {
+        delta_phis[j] = Log(knots[segment + j].inverse() * knots[segment + j + 1]);
+    }
+
+    return delta_phis;
+}
+
+So3Segment::So3Segment(std::pmr::vector<Eigen::Matrix3d> const& knots, int const segment)
+    : i{segment}, R_i{knots[segment]}, delta_phis{DeltaPhis(knots, segment)} {
+    for (int j{0}; j < (constants::k - 1); ++j) {
+        delta_Rs[j] = ScaledExp{delta_phis[j]};
+    }
+}
+
+So3Derivatives EvaluateSo3Segment(So3Segment const& segment, std::array<VectorK, 3> const& u,
+                                  DerivativeOrder const derivative) {
+    static MatrixKK const M{CumulativeBlendingMatrix(constants::k)};  // Static means it only evaluates once :)
+
+    VectorK const weight0{M * u[0]};
+    VectorK const weight1{M * u[1]};
+    VectorK const weight2{M * u[2]};
+
+    So3Derivatives result{segment.R_i, Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero()};
+    for (int j{0}; j < (constants::k - 1); ++j) {
+        Eigen::Matrix3d const delta_R{segment.delta_Rs[j](weight0[j + 1])};
+        result.R = delta_R * result.R;
+        if (derivative == DerivativeOrder::Null) {
+            continue;
+        }
+
+        Eigen::Vector3d const rotated_omega{delta_R * result.omega};
+        Eigen::Vector3d const delta_omega{weight1[j + 1] * segment.delta_phis[j]};
+        if (derivative == DerivativeOrder::Second) {
+            result.alpha = delta_omega.cross(rotated_omega) + (delta_R * result.alpha) +
+                           (weight2[j + 1] * segment.delta_phis[j]);
+        }
+        result.omega = rotated_omega + delta_omega;
+    }
+
+    return result;
+}
+
+Se3Segment::Se3Segment(std::pmr::vector<VectorD> const& positions,
+                       std::pmr::vector<Eigen::Matrix3d> const& rotations, int const segment)
+    : rotation{rotations, segment} {
+    static MatrixKK const M{BlendingMatrix(constants::k)};
+
+    PM = Eigen::Map<const MatrixDK>(positions[segment].data(), constants::d, constants::k) * M;
+}
+
+Se3Derivatives EvaluateSe3Segment(Se3Segment const& segment, std::array<VectorK, 3> const& u,
+                                  DerivativeOrder const derivative) {
+    So3Derivatives const rotation{EvaluateSo3Segment(segment.rotation, u, derivative)};
+
+    return Se3Derivatives{rotation.R,         segment.PM * u[0], rotation.omega,
+                          segment.PM * u[1], rotation.alpha,    segment.PM * u[2]};
+}
+
+}  // namespace reprojection_calibration::spline::internal
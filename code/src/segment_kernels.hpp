@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <array>
+#include <memory_resource>
+#include <vector>
+
+#include "constants.hpp"
+#include "lie.hpp"
+#include "types.hpp"
+
+// Internal building blocks shared by the spline evaluation paths (So3Spline, Se3Spline, EvaluateRelativePose(),
+// Se3SplineSampler etc.) - NOT part of the public interface. Keeping them in one place means there is exactly one
+// implementation of the segment setup and of the derivative recursion.
+namespace reprojection_calibration::spline::internal {
+
+// The time polynomial u^(n)(u_i) / delta_t_ns^n for n = 0, ..., derivative, i.e. what multiplied by a blending matrix
+// gives the blending weights of the n-th time derivative. The orders above derivative are left zero.
+std::array<VectorK, 3> TimeDerivatives(double const u_i, uint64_t const delta_t_ns, DerivativeOrder const derivative);
+
+// The knot increments delta_phi_j = Log(R_i+j^-1 * R_i+j+1) of segment i, for the evaluations that need only these and
+// not the Exp() setup of a full So3Segment.
+std::array<Eigen::Vector3d, constants::k - 1> DeltaPhis(std::pmr::vector<Eigen::Matrix3d> const& knots,
+                                                        int const segment);
+
+// Everything needed to evaluate the rotation in segment i that does not depend on the normalized segment time u_i -
+// the first knot R_i and the knot increments delta_phi_j = Log(R_i+j^-1 * R_i+j+1) with their Exp() setup. Evaluations
+// that fall into the same segment can share it.
+struct So3Segment {
+    So3Segment() = default;
+
+    So3Segment(std::pmr::vector<Eigen::Matrix3d> const& knots, int const segment);
+
+    int i{-1};
+    Eigen::Matrix3d R_i;
+    std::array<Eigen::Vector3d, constants::k - 1> delta_phis;
+    std::array<ScaledExp, constants::k - 1> delta_Rs;  // Exp(weight * delta_phi)
+};
+
+// The rotation together with its angular velocity omega (dR/dt = Hat(omega) * R) and angular acceleration alpha
+// (d omega / dt). The derivatives above the requested order are zero.
+struct So3Derivatives {
+    Eigen::Matrix3d R;
+    Eigen::Vector3d omega;
+    Eigen::Vector3d alpha;
+};
+
+// Composes the rotation as Exp(w_3 * phi_3) * Exp(w_2 * phi_2) * Exp(w_1 * phi_1) * R_i exactly like
+// So3Spline::Evaluate(), together with its exact time derivatives from the forward recursion
+//
+//      omega_j = A_j * omega_j-1 + w_j' * phi_j
+//      alpha_j = (w_j' * phi_j) x (A_j * omega_j-1) + A_j * alpha_j-1 + w_j'' * phi_j,   A_j = Exp(w_j * phi_j)
+//
+// where the weights w are the cumulative blending matrix times the time derivatives u from TimeDerivatives().
+So3Derivatives EvaluateSo3Segment(So3Segment const& segment, std::array<VectorK, 3> const& u,
+                                  DerivativeOrder const derivative);
+
+// Same as So3Segment but for a full pose - the position control points are premultiplied with the blending matrix,
+// so that the position and its derivatives are each one 3x4 times 4x1 product.
+struct Se3Segment {
+    Se3Segment() = default;
+
+    Se3Segment(std::pmr::vector<VectorD> const& positions, std::pmr::vector<Eigen::Matrix3d> const& rotations,
+               int const segment);
+
+    MatrixDK PM;
+    So3Segment rotation;
+};
+
+// A pose with its twist [omega; v] and the derivative of the twist [alpha; a], as separate rotation and translation
+// parts. The derivatives above the requested order are zero.
+struct Se3Derivatives {
+    Eigen::Matrix3d R;
+    Eigen::Vector3d p;
+    Eigen::Vector3d omega;  // dR/dt = Hat(omega) * R
+    Eigen::Vector3d v;      // dp/dt = v
+    Eigen::Vector3d alpha;  // d omega / dt
+    Eigen::Vector3d a;      // dv/dt
+};
+
+Se3Derivatives EvaluateSe3Segment(Se3Segment const& segment, std::array<VectorK, 3> const& u,
+                                  DerivativeOrder const derivative);
+
+}  // namespace reprojection_calibration::spline::internal
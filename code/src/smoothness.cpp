@@ -0,0 +1,95 @@
+#include "smoothness.hpp"
+
+#include <cmath>
+
+#include "constants.hpp"
+#include "lie.hpp"
+#include "utilities.hpp"
+
+namespace reprojection_calibration::spline {
+
+namespace {
+
+// Shared by both regularizers - applies the segment quadratic form Q to every valid segment of the "control points" P.
+double BandedQuadraticForm(Eigen::Ref<MatrixDX const> const& P, MatrixKK const& Q, Eigen::Ref<MatrixDX> gradient,
+                           Eigen::Ref<Eigen::MatrixXd> hessian_band) {
+    int const num_knots{static_cast<int>(P.cols())};
+    assert(gradient.cols() == num_knots);
+    assert(hessian_band.rows() == num_knots and hessian_band.cols() == constants::k);
+
+    double cost{0};
+    for (int s{0}; s + constants::k <= num_knots; ++s) {
+        MatrixDK const P_s{P.middleCols<constants::k>(s)};
+        MatrixDK const PQ{P_s * Q};
+
+        cost += (PQ.array() * P_s.array()).sum();
+        gradient.middleCols<constants::k>(s) += 2 * PQ;
+        for (int a{0}; a < constants::k; ++a) {
+            for (int b{a}; b < constants::k; ++b) {
+                hessian_band(s + a, b - a) += 2 * Q(a, b);
+            }
+        }
+    }
+
+    return cost;
+}
+
+}  // namespace
+
+double SmoothnessRegularizer(r3Spline const& spline, DerivativeOrder const derivative, Eigen::Ref<MatrixDX> gradient,
+                             Eigen::Ref<Eigen::MatrixXd> hessian_band) {
+    int const num_knots{static_cast<int>(std::size(spline.knots_))};
+    if (num_knots == 0) {
+        return 0;
+    }
+
+    MatrixKK const Q{SegmentSmoothnessMatrix(derivative, spline.Timing().delta_t_ns_)};
+    Eigen::Map<MatrixDX const> const P{spline.knots_[0].data(), constants::d, num_knots};
+
+    return BandedQuadraticForm(P, Q, gradient, hessian_band);
+}
+
+double SmoothnessRegularizer(So3Spline const& spline, DerivativeOrder const derivative, Eigen::Ref<MatrixDX> gradient,
+                             Eigen::Ref<Eigen::MatrixXd> hessian_band) {
+    int const num_knots{static_cast<int>(std::size(spline.knots_))};
+    if (num_knots == 0) {
+        return 0;
+    }
+
+    MatrixDX phi{MatrixDX::Zero(constants::d, num_knots)};
+    for (int j{1}; j < num_knots; ++j) {
+        phi.col(j) = phi.col(j - 1) + Log(spline.knots_[j - 1].inverse() * spline.knots_[j]);
+    }
+
+    MatrixKK const Q{SegmentSmoothnessMatrix(derivative, spline.Timing().delta_t_ns_)};
+
+    return BandedQuadraticForm(phi, Q, gradient, hessian_band);
+}
+
+MatrixKK SegmentSmoothnessMatrix(DerivativeOrder const derivative, uint64_t const delta_t_ns) {
+    int const m{static_cast<int>(derivative)};
+    assert(0 <= m and m < constants::k);
+
+    static MatrixKK const M{BlendingMatrix(constants::k)};  // Static means it only evaluates once :)
+    static MatrixKK const polynomial_coefficients{PolynomialCoefficients(constants::k)};
+
+    // Maps the plain time polynomial [1, u, u^2, u^3] to its m-th derivative - see r3Spline::CalculateU()
+    MatrixKK A{MatrixKK::Zero()};
+    for (int j{m}; j < constants::k; ++j) {
+        A(j, j - m) = polynomial_coefficients(m, j);
+    }
+
+    // Integral from zero to one of u^a * u^b - a.k.a. the Hilbert matrix
+    MatrixKK H;
+    for (int a{0}; a < constants::k; ++a) {
+        for (int b{0}; b < constants::k; ++b) {
+            H(a, b) = 1.0 / (a + b + 1);
+        }
+    }
+
+    // The m-th time derivative brings a factor 1/delta_t^m which is squared, and the change of integration variable
+    // from t to u brings one delta_t back.
+    return (M * A * H * A.transpose() * M.transpose()) * std::pow(static_cast<double>(delta_t_ns), 1 - 2 * m);
+}
+
+}  // namespace reprojection_calibration::spline
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "r3_spline.hpp"
+#include "so3_spline.hpp"
+#include "types.hpp"
+
+namespace reprojection_calibration::spline {
+
+// Smoothness prior - the integral of the squared derivative (ex. DerivativeOrder::Second for acceleration or Third for
+// jerk) over the whole valid time range of the spline. For a uniform B-spline the derivative in segment i is
+// P_i * M * u^(m)(u) / delta_t^m, so its squared integral is an exact quadratic form P_i * Q * P_i^T where Q only
+// depends on the blending matrix, the polynomial coefficients and delta_t. The whole regularizer is therefore
+// cost = p^T * H * p / 2 with a symmetric block banded H that is the same for all d coordinates.
+//
+// The gradient (d x num_knots, one column per knot) and the hessian_band (num_knots x k) are ADDED to, so that the
+// caller can accumulate several terms into the same structure. The band uses the upper "LAPACK style" storage, i.e.
+// hessian_band(i, o) = H(i, i + o) for the scalar hessian of a single coordinate. Costs O(num_knots * k^2).
+double SmoothnessRegularizer(r3Spline const& spline, DerivativeOrder const derivative, Eigen::Ref<MatrixDX> gradient,
+                             Eigen::Ref<Eigen::MatrixXd> hessian_band);
+
+// Linearized version of the above for the rotation spline. The knots are unwrapped into the rotation vectors phi_j =
+// phi_j-1 + Log(R_j-1^-1 * R_j) (phi_0 = 0) and the r3 quadratic form is applied to those. The gradient and hessian are
+// with respect to local perturbations R_j * Exp(delta_j) of the knots, with the right jacobian of Log approximated as
+// the identity - exact for rotations about a fixed axis, and a Gauss-Newton style approximation otherwise that is good
+// as long as the rotation between consecutive knots is small.
+double SmoothnessRegularizer(So3Spline const& spline, DerivativeOrder const derivative, Eigen::Ref<MatrixDX> gradient,
+                             Eigen::Ref<Eigen::MatrixXd> hessian_band);
+
+// The k x k matrix Q from above for a single segment.
+MatrixKK SegmentSmoothnessMatrix(DerivativeOrder const derivative, uint64_t const delta_t_ns);
+
+}  // namespace reprojection_calibration::spline
@@ -0,0 +1,117 @@
+#include "smoothness.hpp"
+
+#include <gtest/gtest.h>
+
+#include "constants.hpp"
+#include "lie.hpp"
+
+using namespace reprojection_calibration::spline;
+
+// Assembles the full (single coordinate) hessian from the band storage
+Eigen::MatrixXd FromBand(Eigen::MatrixXd const& hessian_band) {
+    int const n{static_cast<int>(hessian_band.rows())};
+
+    Eigen::MatrixXd H{Eigen::MatrixXd::Zero(n, n)};
+    for (int i{0}; i < n; ++i) {
+        for (int o{0}; o < constants::k and i + o < n; ++o) {
+            H(i, i + o) = hessian_band(i, o);
+            H(i + o, i) = hessian_band(i, o);
+        }
+    }
+
+    return H;
+}
+
+TEST(Smoothness, TestSmoothnessRegularizerQuadraticKnots) {
+    // The cubic B-spline reproduces quadratics, so with knots j^2 the acceleration is a constant 2/delta_t^2 in every
+    // coordinate and the jerk is zero.
+    uint64_t const delta_t_ns{10};
+    int const num_knots{7};
+    r3Spline r3_spline{100, delta_t_ns};
+    for (int j{0}; j < num_knots; ++j) {
+        r3_spline.knots_.push_back(j * j * VectorD::Ones());
+    }
+
+    MatrixDX gradient{MatrixDX::Zero(constants::d, num_knots)};
+    Eigen::MatrixXd hessian_band{Eigen::MatrixXd::Zero(num_knots, constants::k)};
+    double const acceleration_cost{
+        SmoothnessRegularizer(r3_spline, DerivativeOrder::Second, gradient, hessian_band)};
+
+    int const num_segments{num_knots - constants::k + 1};
+    double const acceleration{2.0 / (delta_t_ns * delta_t_ns)};
+    EXPECT_NEAR(acceleration_cost, num_segments * delta_t_ns * constants::d * acceleration * acceleration, 1e-15);
+
+    // Check against the dense sampling approach this replaces
+    auto const a{r3_spline.Evaluate(115, DerivativeOrder::Second)};
+    ASSERT_TRUE(a.has_value());
+    EXPECT_TRUE(a->isApproxToConstant(acceleration));
+
+    gradient.setZero();
+    hessian_band.setZero();
+    double const jerk_cost{SmoothnessRegularizer(r3_spline, DerivativeOrder::Third, gradient, hessian_band)};
+    EXPECT_NEAR(jerk_cost, 0, 1e-15);
+}
+
+TEST(Smoothness, TestSmoothnessRegularizerGradientAndHessian) {
+    uint64_t const delta_t_ns{5};
+    int const num_knots{9};
+    r3Spline r3_spline{100, delta_t_ns};
+    for (int j{0}; j < num_knots; ++j) {
+        r3_spline.knots_.push_back(VectorD{std::sin(j), std::cos(2 * j), 0.1 * j * j});
+    }
+
+    for (auto const derivative : {DerivativeOrder::First, DerivativeOrder::Second, DerivativeOrder::Third}) {
+        MatrixDX gradient{MatrixDX::Zero(constants::d, num_knots)};
+        Eigen::MatrixXd hessian_band{Eigen::MatrixXd::Zero(num_knots, constants::k)};
+        double const cost{SmoothnessRegularizer(r3_spline, derivative, gradient, hessian_band)};
+        EXPECT_GT(cost, 0);
+
+        // It is an exact quadratic form - cost = p^T * H * p / 2 and gradient = H * p for each coordinate
+        Eigen::MatrixXd const H{FromBand(hessian_band)};
+        Eigen::Map<MatrixDX const> const P{r3_spline.knots_[0].data(), constants::d, num_knots};
+        EXPECT_NEAR(cost, 0.5 * (P * H * P.transpose()).trace(), 1e-12 * cost);
+        EXPECT_TRUE(gradient.isApprox(P * H));
+    }
+}
+
+TEST(Smoothness, TestSmoothnessRegularizerEmpty) {
+    r3Spline const r3_spline{100, 5};
+
+    MatrixDX gradient{MatrixDX::Zero(constants::d, 0)};
+    Eigen::MatrixXd hessian_band{Eigen::MatrixXd::Zero(0, constants::k)};
+    EXPECT_EQ(SmoothnessRegularizer(r3_spline, DerivativeOrder::Second, gradient, hessian_band), 0);
+}
+
+TEST(Smoothness, TestSmoothnessRegularizerSo3) {
+    // Rotations about a fixed axis are where the linearization is exact, so the result must match the r3 regularizer
+    // applied to the rotation vectors.
+    uint64_t const delta_t_ns{5};
+    int const num_knots{8};
+    Eigen::Vector3d const axis{Eigen::Vector3d{1, 2, 3}.normalized()};
+
+    So3Spline so3_spline{100, delta_t_ns};
+    r3Spline r3_spline{100, delta_t_ns};
+    for (int j{0}; j < num_knots; ++j) {
+        double const angle{0.02 * j * j};
+        so3_spline.knots_.push_back(Exp(angle * axis));
+        r3_spline.knots_.push_back(angle * axis);
+    }
+
+    MatrixDX so3_gradient{MatrixDX::Zero(constants::d, num_knots)};
+    Eigen::MatrixXd so3_hessian_band{Eigen::MatrixXd::Zero(num_knots, constants::k)};
+    double const so3_cost{SmoothnessRegularizer(so3_spline, DerivativeOrder::Second, so3_gradient, so3_hessian_band)};
+
+    MatrixDX r3_gradient{MatrixDX::Zero(constants::d, num_knots)};
+    Eigen::MatrixXd r3_hessian_band{Eigen::MatrixXd::Zero(num_knots, constants::k)};
+    double const r3_cost{SmoothnessRegularizer(r3_spline, DerivativeOrder::Second, r3_gradient, r3_hessian_band)};
+
+    EXPECT_NEAR(so3_cost, r3_cost, 1e-12 * r3_cost);
+    EXPECT_TRUE(so3_gradient.isApprox(r3_gradient));
+    EXPECT_TRUE(so3_hessian_band.isApprox(r3_hessian_band));
+
+    // Not enough knots for a single segment
+    So3Spline const empty_spline{100, delta_t_ns};
+    MatrixDX empty_gradient{MatrixDX::Zero(constants::d, 0)};
+    Eigen::MatrixXd empty_hessian_band{Eigen::MatrixXd::Zero(0, constants::k)};
+    EXPECT_EQ(SmoothnessRegularizer(empty_spline, DerivativeOrder::Second, empty_gradient, empty_hessian_band), 0);
+}
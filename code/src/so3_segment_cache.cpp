@@ -0,0 +1,70 @@
+#include "so3_segment_cache.hpp"
+
+#include <algorithm>
+
+#include "constants.hpp"
+
+namespace reprojection_calibration::spline {
+
+So3SegmentCache::So3SegmentCache(So3Spline const& spline) : spline_{spline}, synced_version_{0} { Update(); }
+
+int So3SegmentCache::Update() {
+    size_t const num_knots{std::size(spline_.knots_)};
+    size_t const num_segments{(num_knots >= constants::k) ? num_knots - constants::k + 1 : 0};
+    size_t const num_cached{std::min(std::size(segments_), num_segments)};
+
+    DirtySegmentTracker const& tracker{spline_.Tracker()};
+    std::vector<int> const dirty_segments{tracker.DirtySegments(num_knots, synced_version_)};
+    synced_version_ = tracker.Version();
+
+    segments_.resize(num_segments);
+    int num_built{0};
+    for (int const i : dirty_segments) {
+        if (static_cast<size_t>(i) < num_cached) {
+            segments_[i] = internal::So3Segment{spline_.knots_, i};
+            ++num_built;
+        }
+    }
+    for (size_t i{num_cached}; i < num_segments; ++i) {
+        segments_[i] = internal::So3Segment{spline_.knots_, static_cast<int>(i)};
+        ++num_built;
+    }
+
+    return num_built;
+}
+
+std::optional<Eigen::Matrix3d> So3SegmentCache::Evaluate(uint64_t const t_ns) const {
+    auto const result{EvaluateSegment(t_ns, 0.0, DerivativeOrder::Null)};
+    if (not result.has_value()) {
+        return std::nullopt;
+    }
+
+    return result->R;
+}
+
+std::optional<std::tuple<Eigen::Matrix3d, Eigen::Vector3d>> So3SegmentCache::EvaluateWithTimeDerivative(
+    uint64_t const t_ns, double const offset_ns) const {
+    auto const result{EvaluateSegment(t_ns, offset_ns, DerivativeOrder::First)};
+    if (not result.has_value()) {
+        return std::nullopt;
+    }
+
+    return std::tuple{result->R, result->omega};
+}
+
+std::optional<internal::So3Derivatives> So3SegmentCache::EvaluateSegment(uint64_t const t_ns, double const offset_ns,
+                                                                         DerivativeOrder const derivative) const {
+    // The number of knots the cache was built for, which is only the same as the spline's if Update() is up to date
+    size_t const num_knots{std::empty(segments_) ? 0 : std::size(segments_) + constants::k - 1};
+    auto const normalized_position{spline_.Timing().SplinePosition(t_ns, offset_ns, num_knots)};
+    if (not normalized_position.has_value()) {
+        return std::nullopt;
+    }
+    auto const [u_i, i]{normalized_position.value()};
+
+    auto const u{internal::TimeDerivatives(u_i, spline_.Timing().delta_t_ns_, derivative)};
+
+    return internal::EvaluateSo3Segment(segments_[i], u, derivative);
+}
+
+}  // namespace reprojection_calibration::spline
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "segment_kernels.hpp"
+#include "so3_spline.hpp"
+
+namespace reprojection_calibration::spline {
+
+// Keeps the segment setup (the knot increments Log(R_i+j^-1 * R_i+j+1) and their Exp() setup) of every segment of a
+// So3Spline precomputed, so that evaluations skip the Log() calls entirely. After knot edits Update() rebuilds only
+// the segments that the spline's dirty segment tracker marked since the last Update() - k segments for a single
+// SetKnot() instead of all of them - plus the segments of appended knots.
+//
+// WARN(Jack): The cache keeps a reference to the spline, so the spline has to outlive it. Knot edits that bypass the
+// tracker (i.e. writing to knots_ directly) are not detected, appending to knots_ directly is.
+class So3SegmentCache {
+   public:
+    explicit So3SegmentCache(So3Spline const& spline);
+
+    // Returns the number of segments that were (re)built.
+    int Update();
+
+    // Same as So3Spline::Evaluate() and So3Spline::EvaluateWithTimeDerivative(), as of the last Update().
+    std::optional<Eigen::Matrix3d> Evaluate(uint64_t const t_ns) const;
+
+    std::optional<std::tuple<Eigen::Matrix3d, Eigen::Vector3d>> EvaluateWithTimeDerivative(
+        uint64_t const t_ns, double const offset_ns = 0.0) const;
+
+   private:
+    std::optional<internal::So3Derivatives> EvaluateSegment(uint64_t const t_ns, double const offset_ns,
+                                                            DerivativeOrder const derivative) const;
+
+    So3Spline const& spline_;
+    std::vector<internal::So3Segment> segments_;
+    uint64_t synced_version_;  // Tracker version at the last Update()
+};
+
+}  // namespace reprojection_calibration::spline
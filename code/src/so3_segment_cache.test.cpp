@@ -0,0 +1,69 @@
+#include "so3_segment_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "constants.hpp"
+#include "lie.hpp"
+
+using namespace reprojection_calibration::spline;
+
+namespace {
+
+void ExpectMatchesSpline(So3SegmentCache const& cache, So3Spline const& so3_spline) {
+    uint64_t const end_ns{100 + (std::size(so3_spline.knots_) - constants::k + 1) * 5};
+    for (uint64_t t_ns{100}; t_ns < end_ns; ++t_ns) {
+        auto const rotation{cache.Evaluate(t_ns)};
+        ASSERT_TRUE(rotation.has_value());
+        EXPECT_TRUE(rotation->isApprox(so3_spline.Evaluate(t_ns).value()));
+
+        auto const [R, omega]{cache.EvaluateWithTimeDerivative(t_ns, 0.5).value()};
+        auto const [R_spline, omega_spline]{so3_spline.EvaluateWithTimeDerivative(t_ns, 0.5).value()};
+        EXPECT_TRUE(R.isApprox(R_spline));
+        EXPECT_TRUE(omega.isApprox(omega_spline));
+    }
+    EXPECT_EQ(cache.Evaluate(end_ns), std::nullopt);
+}
+
+}  // namespace
+
+TEST(So3SegmentCache, TestSo3SegmentCacheUpdate) {
+    So3Spline so3_spline{100, 5};
+    for (int i{0}; i < 10; ++i) {
+        so3_spline.knots_.push_back(Exp((static_cast<double>(i) / 10) * Eigen::Vector3d{1.0, -0.5, 0.2 * i}));
+    }
+
+    So3SegmentCache cache{so3_spline};  // Builds all seven segments
+    EXPECT_EQ(cache.Update(), 0);
+    ExpectMatchesSpline(cache, so3_spline);
+
+    // A second consumer that already synced and the owner clearing the tracker do not affect the cache
+    So3SegmentCache other_cache{so3_spline};
+    so3_spline.SetKnot(5, Exp(0.3 * Eigen::Vector3d::UnitX()));
+    EXPECT_EQ(other_cache.Update(), constants::k);
+    so3_spline.ClearDirtySegments();
+    EXPECT_EQ(cache.Update(), constants::k);  // Only the segments 2, 3, 4 and 5 that knot 5 influences
+    ExpectMatchesSpline(cache, so3_spline);
+
+    // Appending directly to the knots builds the new segment only
+    so3_spline.knots_.push_back(Exp(0.2 * Eigen::Vector3d::UnitY()));
+    EXPECT_EQ(cache.Update(), 1);
+    ExpectMatchesSpline(cache, so3_spline);
+
+    // Erasing shifts every later knot, and the last segment disappears
+    so3_spline.EraseKnot(8);
+    EXPECT_EQ(cache.Update(), 2);  // Segments 5 and 6 of the now seven segments
+    ExpectMatchesSpline(cache, so3_spline);
+}
+
+TEST(So3SegmentCache, TestSo3SegmentCacheInvalidEvaluateConditions) {
+    So3Spline so3_spline{100, 5};
+    for (int i{0}; i < constants::k; ++i) {
+        so3_spline.knots_.push_back(Eigen::Matrix3d::Identity());
+    }
+    So3SegmentCache const cache{so3_spline};
+
+    // One segment, valid in [100, 105)
+    EXPECT_NE(cache.EvaluateWithTimeDerivative(104), std::nullopt);
+    EXPECT_EQ(cache.EvaluateWithTimeDerivative(105), std::nullopt);
+    EXPECT_EQ(cache.EvaluateWithTimeDerivative(100, -0.5), std::nullopt);
+}
@@ -1,27 +1,22 @@
 #include "so3_spline.hpp"
 
+#include <algorithm>
 #include <numeric>
 
 #include "constants.hpp"
 #include "lie.hpp"
 #include "r3_spline.hpp"  // REMOVE AND USE COMMON GENERIC IMPLEMENTATION
+#include "segment_kernels.hpp"
 #include "types.hpp"
 #include "utilities.hpp"
 
 namespace reprojection_calibration::spline {
 
-// WARN(Jack): Will not check that the knots are valid to index! Depends on being called securely with an index from the
-// time handler.
-std::array<Eigen::Vector3d, constants::k - 1> DeltaPhi(std::vector<Eigen::Matrix3d> const& knots, int const segment) {
-    std::array<Eigen::Vector3d, constants::k - 1> delta_phi;
-    for (int j{0}; j < (constants::k - 1); ++j) {
-        delta_phi[j] = Log(knots[segment + j].inverse() * knots[segment + j + 1]);
-    }
-    return delta_phi;
-}
-
-So3Spline::So3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns)
-    : time_handler_{t0_ns, delta_t_ns, constants::k}, M_{CumulativeBlendingMatrix(constants::k)} {}
+So3Spline::So3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns, std::pmr::memory_resource* const resource)
+    : knots_{resource},
+      time_handler_{t0_ns, delta_t_ns, constants::k},
+      M_{CumulativeBlendingMatrix(constants::k)},
+      tracker_{constants::k} {}
 
 std::optional<Eigen::Matrix3d> So3Spline::Evaluate(uint64_t const t_ns) const {
     auto const normalized_position{time_handler_.SplinePosition(t_ns, std::size(knots_))};
@@ -32,21 +27,9 @@ std::optional<Eigen::Matrix3d> So3Spline::Evaluate(uint64_t const t_ns) const {
 
     // TODO(Jack): Use common generic method one! Pay attention to how we use the constants here though! If we will
     // always be the same dimension for both position and rotation maybe that simplifies things.
-    VectorK const u0{r3Spline::CalculateU(u_i, DerivativeOrder::Null)};
-    VectorK const weight0{M_ * u0};
-
-    // TODO(Jack): What is really the right size for all of these?
-    // TODO(Jack): Is it possible or worth it to functionalize the velocity calculation?
-    std::array<Eigen::Vector3d, constants::k - 1> const delta_phis{DeltaPhi(knots_, i)};
-
-    // TODO(Jack): Can we replace this all with a std::accumulate call?
-    Eigen::Matrix3d rotation{knots_[i]};
-    for (int j{0}; j < (constants::k - 1); ++j) {
-        Eigen::Matrix3d const delta_R{Exp(weight0[j + 1] * delta_phis[j])};
-        rotation = delta_R * rotation;
-    }
+    auto const u{internal::TimeDerivatives(u_i, time_handler_.delta_t_ns_, DerivativeOrder::Null)};
 
-    return rotation;
+    return internal::EvaluateSo3Segment(internal::So3Segment{knots_, i}, u, DerivativeOrder::Null).R;
 }
 
 // TODO(Jack): We could return matrices from all these by returning skew symmetric matrices, but I am not sure if that
@@ -63,7 +46,7 @@ std::optional<Eigen::Vector3d> So3Spline::EvaluateVelocity(uint64_t const t_ns)
     VectorK const u1{r3Spline::CalculateU(u_i, DerivativeOrder::First)};
     VectorK const weight1{M_ * u1 / std::pow(time_handler_.delta_t_ns_, static_cast<int>(DerivativeOrder::First))};
 
-    std::array<Eigen::Vector3d, constants::k - 1> const delta_phis{DeltaPhi(knots_, i)};
+    std::array<Eigen::Vector3d, constants::k - 1> const delta_phis{internal::DeltaPhis(knots_, i)};
 
     Eigen::Vector3d velocity{Eigen::Vector3d::Zero()};
     for (int j{0}; j < (constants::k - 1); ++j) {
@@ -90,7 +73,7 @@ std::optional<Eigen::Vector3d> So3Spline::EvaluateAcceleration(uint64_t const t_
     VectorK const u2{r3Spline::CalculateU(u_i, DerivativeOrder::Second)};
     VectorK const weight2{M_ * u2 / std::pow(time_handler_.delta_t_ns_, static_cast<int>(DerivativeOrder::Second))};
 
-    std::array<Eigen::Vector3d, constants::k - 1> const delta_phis{DeltaPhi(knots_, i)};
+    std::array<Eigen::Vector3d, constants::k - 1> const delta_phis{internal::DeltaPhis(knots_, i)};
 
     Eigen::Vector3d velocity{Eigen::Vector3d::Zero()};
     Eigen::Vector3d acceleration{Eigen::Vector3d::Zero()};
@@ -107,4 +90,78 @@ std::optional<Eigen::Vector3d> So3Spline::EvaluateAcceleration(uint64_t const t_
     return acceleration;
 }
 
+std::optional<std::tuple<Eigen::Matrix3d, Eigen::Vector3d>> So3Spline::EvaluateWithTimeDerivative(
+    uint64_t const t_ns, double const offset_ns) const {
+    auto const normalized_position{time_handler_.SplinePosition(t_ns, offset_ns, std::size(knots_))};
+    if (not normalized_position.has_value()) {
+        return std::nullopt;
+    }
+    auto const [u_i, i]{normalized_position.value()};
+
+    auto const u{internal::TimeDerivatives(u_i, time_handler_.delta_t_ns_, DerivativeOrder::First)};
+    internal::So3Derivatives const result{
+        internal::EvaluateSo3Segment(internal::So3Segment{knots_, i}, u, DerivativeOrder::First)};
+
+    return std::tuple{result.R, result.omega};
+}
+
+std::vector<std::optional<Eigen::Matrix3d>> So3Spline::Evaluate(std::vector<uint64_t> const& t_ns) const {
+    std::vector<std::optional<Eigen::Matrix3d>> rotations;
+    rotations.reserve(std::size(t_ns));
+
+    internal::So3Segment segment;
+    for (uint64_t const t_ns_i : t_ns) {
+        auto const normalized_position{time_handler_.SplinePosition(t_ns_i, std::size(knots_))};
+        if (not normalized_position.has_value()) {
+            rotations.push_back(std::nullopt);
+            continue;
+        }
+        auto const [u_i, i]{normalized_position.value()};
+
+        if (segment.i != i) {
+            segment = internal::So3Segment{knots_, i};
+        }
+
+        auto const u{internal::TimeDerivatives(u_i, time_handler_.delta_t_ns_, DerivativeOrder::Null)};
+        rotations.push_back(internal::EvaluateSo3Segment(segment, u, DerivativeOrder::Null).R);
+    }
+
+    return rotations;
+}  // LCOV_EXCL_LINE
+
+void So3Spline::SetKnot(int const i, Eigen::Matrix3d const& knot) {
+    assert(0 <= i and static_cast<size_t>(i) < std::size(knots_));
+
+    knots_[i] = knot;
+    tracker_.MarkKnots(i, i + 1);
+}
+
+void So3Spline::InsertKnot(int const i, Eigen::Matrix3d const& knot) {
+    assert(0 <= i and static_cast<size_t>(i) <= std::size(knots_));
+
+    knots_.insert(std::begin(knots_) + i, knot);
+    tracker_.MarkKnotsFrom(i);
+}
+
+void So3Spline::EraseKnot(int const i) {
+    assert(0 <= i and static_cast<size_t>(i) < std::size(knots_));
+
+    knots_.erase(std::begin(knots_) + i);
+    tracker_.MarkKnotsFrom(i);
+}
+
+void So3Spline::UpdateKnots(int const first, Eigen::Matrix3d const* const knots, size_t const count) {
+    assert(0 <= first and first + count <= std::size(knots_));
+    assert(knots != nullptr or count == 0);
+
+    std::copy(knots, knots + count, std::begin(knots_) + first);
+    tracker_.MarkKnots(first, first + static_cast<int>(count));
+}
+
+DirtySegmentTracker const& So3Spline::Tracker() const { return tracker_; }
+
+TimeHandler const& So3Spline::Timing() const { return time_handler_; }
+
+void So3Spline::ClearDirtySegments() { tracker_.Clear(); }
+
 }  // namespace reprojection_calibration::spline
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory_resource>
+#include <vector>
+
+#include "dirty_segment_tracker.hpp"
 #include "types.hpp"
 #include "utilities.hpp"
 
@@ -9,7 +13,9 @@ namespace reprojection_calibration::spline {
 // peeled for cost effective and well abstracted optimizations!
 class So3Spline {
    public:
-    So3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns);
+    // See r3Spline for the memory resource.
+    So3Spline(uint64_t const t0_ns, uint64_t const delta_t_ns,
+              std::pmr::memory_resource* const resource = std::pmr::get_default_resource());
 
     std::optional<Eigen::Matrix3d> Evaluate(uint64_t const t_ns) const;
 
@@ -17,15 +23,48 @@ class So3Spline {
 
     std::optional<Eigen::Vector3d> EvaluateAcceleration(uint64_t const t_ns) const;
 
+    // Evaluates the rotation at the time t_ns + offset_ns, where the offset can be fractional and negative, together
+    // with its exact time derivative expressed as the angular velocity omega where dR/dt = Hat(omega) * R.
+    // NOTE(Jack): Evaluate() composes the increments as Exp(w_2 * phi_2) * Exp(w_1 * phi_1) * ... * R_i, so the
+    // matching derivative recursion is omega_j = Exp(w_j * phi_j) * omega_j-1 + w_j' * phi_j. This is not the same as
+    // the recursion in EvaluateVelocity() which applies the inverse increments, and therefore the two velocities differ
+    // unless all increments share the same axis!
+    std::optional<std::tuple<Eigen::Matrix3d, Eigen::Vector3d>> EvaluateWithTimeDerivative(
+        uint64_t const t_ns, double const offset_ns = 0.0) const;
+
+    // Batch version of Evaluate() for densely spaced timestamps (ex. the rows of a rolling shutter image). Consecutive
+    // timestamps that fall into the same segment share the Log() and Exp() setup of that segment, so the timestamps
+    // should be sorted to get the most out of it.
+    std::vector<std::optional<Eigen::Matrix3d>> Evaluate(std::vector<uint64_t> const& t_ns) const;
+
+    // Knot editing API - see the matching methods in r3Spline.
+    void SetKnot(int const i, Eigen::Matrix3d const& knot);
+
+    void InsertKnot(int const i, Eigen::Matrix3d const& knot);
+
+    void EraseKnot(int const i);
+
+    // Overwrites the count knots starting at index first with the contiguous array knots (ex. directly from a numpy
+    // array or any other raw buffer of column major 3x3 matrices).
+    void UpdateKnots(int const first, Eigen::Matrix3d const* const knots, size_t const count);
+
+    DirtySegmentTracker const& Tracker() const;
+
+    TimeHandler const& Timing() const;
+
+    void ClearDirtySegments();
+
     // NOTE(Jack): It would feel more natural to store the so3 vectors here but the math required in the evaluate
     // function happens more in the SO3 space so it makes more sense to have the knots be in that format - it is also
     // what people would expect to get returned from the Evaluate() function, so we are consistent.
     // TODO(Jack): When adding a knot should we check that it is a rotation matrix?
-    std::vector<Eigen::Matrix3d> knots_;
+    // WARN(Jack): Writing to the knots directly bypasses the dirty segment tracker!
+    std::pmr::vector<Eigen::Matrix3d> knots_;
 
    private:
     TimeHandler time_handler_;
     MatrixKK const M_;
+    DirtySegmentTracker tracker_;
 };
 
 }  // namespace reprojection_calibration::spline
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+
 #include "constants.hpp"
 #include "lie.hpp"
 #include "utilities_testing.hpp"
@@ -87,4 +89,85 @@ TEST(So3Spline, TestSo3SplineEvaluateAcceleration) {
 
     Eigen::Vector3d const v4{so3_spline.EvaluateAcceleration(104).value()};
     EXPECT_TRUE(v4.isApproxToConstant(0.004));
-}
\ No newline at end of file
+}
+
+TEST(So3Spline, TestSo3SplineKnotEditing) {
+    So3Spline so3_spline{100, 5};
+    for (int i{0}; i < 6; ++i) {
+        so3_spline.knots_.push_back(Eigen::Matrix3d::Identity());
+    }
+    EXPECT_TRUE(so3_spline.Tracker().DirtySegments(std::size(so3_spline.knots_)).empty());  // Bypassed the tracker
+
+    Eigen::Matrix3d const R{Exp(0.1 * Eigen::Vector3d::Ones())};
+    so3_spline.SetKnot(5, R);
+    EXPECT_TRUE(so3_spline.knots_[5].isApprox(R));
+    EXPECT_EQ(so3_spline.Tracker().DirtySegments(std::size(so3_spline.knots_)), (std::vector<int>{2}));
+
+    so3_spline.ClearDirtySegments();
+    std::array<Eigen::Matrix3d, 2> const update{R, R};
+    so3_spline.UpdateKnots(0, std::data(update), std::size(update));
+    EXPECT_TRUE(so3_spline.knots_[1].isApprox(R));
+    EXPECT_EQ(so3_spline.Tracker().DirtySegments(std::size(so3_spline.knots_)), (std::vector<int>{0, 1}));
+
+    so3_spline.ClearDirtySegments();
+    so3_spline.InsertKnot(0, Eigen::Matrix3d::Identity());
+    so3_spline.EraseKnot(6);
+    EXPECT_EQ(std::size(so3_spline.knots_), 6);
+    EXPECT_TRUE(so3_spline.knots_[0].isIdentity());
+    EXPECT_EQ(so3_spline.Tracker().DirtySegments(std::size(so3_spline.knots_)), (std::vector<int>{0, 1, 2}));
+}
+
+TEST(So3Spline, TestSo3SplineEvaluateBatch) {
+    So3Spline so3_spline{100, 5};
+    so3_spline.knots_.push_back(Exp(Eigen::Vector3d::Zero()));
+    for (int i{1}; i < constants::k + 1; ++i) {
+        so3_spline.knots_.push_back(so3_spline.knots_.back() *
+                                    Exp((static_cast<double>(i) / 10) * Eigen::Vector3d{1, -2, 3}));
+    }
+
+    std::vector<uint64_t> const t_ns{100, 101, 104, 105, 109, 110};  // Crosses into the second segment and beyond
+    auto const rotations{so3_spline.Evaluate(t_ns)};
+    ASSERT_EQ(std::size(rotations), std::size(t_ns));
+
+    for (size_t i{0}; i < std::size(t_ns); ++i) {
+        auto const rotation{so3_spline.Evaluate(t_ns[i])};
+        ASSERT_EQ(rotations[i].has_value(), rotation.has_value());
+
+        if (rotation.has_value()) {
+            EXPECT_TRUE(IsRotation(rotations[i].value()));
+            EXPECT_TRUE(rotations[i]->isApprox(rotation.value()));
+        }
+    }
+    EXPECT_EQ(rotations.back(), std::nullopt);
+}
+
+TEST(So3Spline, TestSo3SplineEvaluateWithTimeDerivative) {
+    So3Spline so3_spline{100, 5};
+    so3_spline.knots_.push_back(Exp(Eigen::Vector3d::Zero()));
+    for (int i{1}; i < constants::k + 1; ++i) {
+        so3_spline.knots_.push_back(so3_spline.knots_.back() *
+                                    Exp((static_cast<double>(i) / 10) * Eigen::Vector3d{1.0 * i, -2.0 + i * i, 0.5}));
+    }
+
+    // Zero offset rotation is the same as Evaluate()
+    auto const result_0{so3_spline.EvaluateWithTimeDerivative(102)};
+    ASSERT_TRUE(result_0.has_value());
+    EXPECT_TRUE(std::get<0>(result_0.value()).isApprox(so3_spline.Evaluate(102).value()));
+
+    // Central finite difference with sub-nanosecond offsets, which the integer timestamps cannot represent
+    double const h{1e-4};
+    for (double const offset_ns : {0.25, -0.3, 2.7}) {
+        auto const result{so3_spline.EvaluateWithTimeDerivative(104, offset_ns)};
+        ASSERT_TRUE(result.has_value());
+        auto const [R, omega]{result.value()};
+        EXPECT_TRUE(IsRotation(R));
+
+        Eigen::Matrix3d const R_plus{std::get<0>(so3_spline.EvaluateWithTimeDerivative(104, offset_ns + h).value())};
+        Eigen::Matrix3d const R_minus{std::get<0>(so3_spline.EvaluateWithTimeDerivative(104, offset_ns - h).value())};
+        Eigen::Vector3d const numerical_omega{Log(R_plus * R_minus.transpose()) / (2 * h)};
+
+        EXPECT_TRUE(omega.isApprox(numerical_omega, 1e-6));
+    }
+
+    EXPECT_EQ(so3_spline.EvaluateWithTimeDerivative(100, -1.0), std::nullopt);
+}
@@ -7,10 +7,12 @@
 namespace reprojection_calibration::spline {
 
 using MatrixDK = Eigen::Matrix<double, constants::d, constants::k>;
+using MatrixDX = Eigen::Matrix<double, constants::d, Eigen::Dynamic>;
 using MatrixKK = Eigen::Matrix<double, constants::k, constants::k>;
 using VectorD = Eigen::Vector<double, constants::d>;
 using VectorK = Eigen::Vector<double, constants::k>;
+using Vector6d = Eigen::Vector<double, 6>;  // se3 "twist" - rotational part on top and translational part on the bottom
 
-enum class DerivativeOrder { Null = 0, First = 1, Second = 2 };
+enum class DerivativeOrder { Null = 0, First = 1, Second = 2, Third = 3 };
 
 }  // namespace reprojection_calibration::spline
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <cmath>
 #include <optional>
 #include <tuple>
 
@@ -34,6 +35,10 @@ class TimeHandler {
         : t0_ns_{t0_ns}, delta_t_ns_{delta_t_ns}, k_{k} {}
 
     std::optional<std::tuple<double, int>> SplinePosition(uint64_t const t_ns, size_t const num_knots) const {
+        if (t_ns < t0_ns_) {
+            return std::nullopt;
+        }
+
         auto const [u_i, i]{NormalizedSegmentTime(t0_ns_, t_ns, delta_t_ns_)};
 
         // From reference [1] - "At time t in [t_i, t_i+1) the value of p(t) only depends on the control points p_i,
@@ -45,6 +50,30 @@ class TimeHandler {
         return std::tuple{u_i, i};
     }
 
+    // Same as above but for the time t_ns + offset_ns, where the offset can be fractional and negative (ex. a time
+    // offset under estimation in a camera-imu time synchronization).
+    std::optional<std::tuple<double, int>> SplinePosition(uint64_t const t_ns, double const offset_ns,
+                                                          size_t const num_knots) const {
+        if (not std::isfinite(offset_ns)) {
+            return std::nullopt;
+        }
+
+        // Subtract in integer arithmetic first - absolute nanosecond timestamps are too big for a double's mantissa
+        double const elapsed_ns{(t_ns >= t0_ns_) ? static_cast<double>(t_ns - t0_ns_) + offset_ns
+                                                 : offset_ns - static_cast<double>(t0_ns_ - t_ns)};
+        if (elapsed_ns < 0) {
+            return std::nullopt;
+        }
+
+        double const s_t{elapsed_ns / delta_t_ns_};
+        double const i{std::floor(s_t)};
+        if (static_cast<double>(num_knots) < i + k_) {  // Compared as doubles so that huge offsets cannot overflow
+            return std::nullopt;
+        }
+
+        return std::tuple{s_t - i, static_cast<int>(i)};
+    }
+
     uint64_t t0_ns_;
     uint64_t delta_t_ns_;
     int k_;
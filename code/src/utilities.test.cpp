@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+
 using namespace reprojection_calibration::spline;
 
 // Reference [1] Efficient Derivative Computation for B-Splines on Lie Groups
@@ -75,4 +77,39 @@ TEST(Utilities, TestFactorial) {
     EXPECT_EQ(Factorial(1), 1);
     EXPECT_EQ(Factorial(2), 2);
     EXPECT_EQ(Factorial(3), 6);
-}
\ No newline at end of file
+}
+
+TEST(Utilities, TestTimeHandlerSplinePositionOffset) {
+    TimeHandler const time_handler{100, 5, 4};
+
+    // Zero offset is the same as the plain integer version
+    auto const position{time_handler.SplinePosition(107, 0.0, 10)};
+    ASSERT_TRUE(position.has_value());
+    EXPECT_FLOAT_EQ(std::get<0>(position.value()), 0.4);
+    EXPECT_EQ(std::get<1>(position.value()), 1);
+
+    // Fractional negative offset that moves back into the previous segment
+    auto const position_1{time_handler.SplinePosition(105, -0.5, 10)};
+    ASSERT_TRUE(position_1.has_value());
+    EXPECT_FLOAT_EQ(std::get<0>(position_1.value()), 0.9);
+    EXPECT_EQ(std::get<1>(position_1.value()), 0);
+
+    // Before t0 - either by the timestamp itself or through the offset
+    EXPECT_EQ(time_handler.SplinePosition(100, -0.1, 10), std::nullopt);
+    EXPECT_EQ(time_handler.SplinePosition(99, 0.5, 10), std::nullopt);
+    EXPECT_EQ(time_handler.SplinePosition(99, 10), std::nullopt);  // Same for the plain integer version
+
+    // A timestamp before t0 can still be valid when the offset moves it forward
+    auto const position_2{time_handler.SplinePosition(99, 2.0, 10)};
+    ASSERT_TRUE(position_2.has_value());
+    EXPECT_FLOAT_EQ(std::get<0>(position_2.value()), 0.2);
+
+    // Not enough knots for the segment
+    EXPECT_EQ(time_handler.SplinePosition(105, 0.5, 4), std::nullopt);
+
+    // Non-finite offsets (ex. a diverged time offset estimate) and finite ones too large for any spline
+    EXPECT_EQ(time_handler.SplinePosition(105, std::numeric_limits<double>::quiet_NaN(), 10), std::nullopt);
+    EXPECT_EQ(time_handler.SplinePosition(105, std::numeric_limits<double>::infinity(), 10), std::nullopt);
+    EXPECT_EQ(time_handler.SplinePosition(105, -std::numeric_limits<double>::infinity(), 10), std::nullopt);
+    EXPECT_EQ(time_handler.SplinePosition(105, 1e300, 10), std::nullopt);
+}